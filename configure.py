@@ -95,6 +95,30 @@ parser.add_argument(
     help="build with debug info (non-matching)",
     default=True,
 )
+parser.add_argument(
+    "--perf",
+    action="store_true",
+    help="build with the emulator performance changes (non-matching)",
+)
+parser.add_argument(
+    "--perf-stats",
+    metavar="FRAMES",
+    type=int,
+    default=0,
+    help="with --perf, print emulator statistics every FRAMES frames (default: 0, never)",
+)
+parser.add_argument(
+    "--rom-extent",
+    metavar="BYTES",
+    type=lambda x: int(x, 0),
+    default=0,
+    help="with --perf, read uncached ROM blocks in extents of up to BYTES (8 KiB to 64 KiB; default: 8 KiB)",
+)
+parser.add_argument(
+    "--rom-trace",
+    action="store_true",
+    help="with --perf, trace ROM block accesses for tools/rom_pinset.py",
+)
 if not is_windows():
     parser.add_argument(
         "--wrapper",
@@ -205,6 +229,16 @@ if config.debug:
 else:
     cflags_base.append("-DNDEBUG=1")
 
+# Performance flags
+if args.perf:
+    cflags_base.append("-DSIM_PERF=1")
+    if args.perf_stats > 0:
+        cflags_base.append(f"-DSIM_PERF_STATS={args.perf_stats}")
+    if args.rom_extent > 0:
+        cflags_base.append(f"-DSIM_PERF_ROM_EXTENT={args.rom_extent:#x}")
+    if args.rom_trace:
+        cflags_base.append("-DSIM_PERF_ROM_TRACE=1")
+
 # SIM flags
 cflags_sim = [
     *cflags_base,
@@ -5,6 +5,23 @@
 #include "emulator/rsp.h"
 #include "emulator/xlObject.h"
 
+#ifdef SIM_PERF
+// Number of frames of RDP statistics kept for `rdpDumpStats`
+#define RDP_STATS_COUNT 16
+
+// RDP commands parsed in one frame
+typedef struct RdpStats {
+    /* 0x00 */ u32 nCountCommand;
+    /* 0x04 */ u32 nCountLoadTexture; // G_LOADTILE and G_LOADBLOCK
+    /* 0x08 */ u32 nCountLoadTLUT;
+    /* 0x0C */ u32 nCountSetTexture; // G_SETTIMG
+    /* 0x10 */ u32 nCountSetCombine;
+    /* 0x14 */ u32 nCountRectangle; // G_TEXRECT, G_TEXRECTFLIP and G_FILLRECT
+    /* 0x18 */ u32 nCountTriangle;
+    /* 0x1C */ OSTick nTickParse; // Time spent in `rdpParseGBI`
+} RdpStats; // size = 0x20
+#endif
+
 typedef struct Rdp {
     /* 0x00 */ s32 nBIST;
     /* 0x04 */ s32 nStatus;
@@ -18,9 +35,22 @@ typedef struct Rdp {
     /* 0x24 */ s32 nClockCmd;
     /* 0x28 */ s32 nClockPipe;
     /* 0x2C */ s32 nClockTMEM;
+#ifdef SIM_PERF
+    /* 0x30 */ u32 nFrame; // Frames closed by `rdpUpdateStats`
+    /* 0x34 */ s32 iStats; // Record of the frame in progress
+    /* 0x38 */ s32 nCountStats; // Frames closed since the last dump
+    /* 0x3C */ u32 anCountOpcode[64]; // Commands 0xC0 to 0xFF since the last dump
+    /* 0x13C */ RdpStats aStats[RDP_STATS_COUNT];
+} Rdp; // size = 0x33C
+#else
 } Rdp; // size = 0x30
+#endif
 
 bool rdpParseGBI(Rdp* pRDP, u64** ppnGBI, RspUCodeType eTypeUCode);
+#ifdef SIM_PERF
+bool rdpUpdateStats(Rdp* pRDP);
+bool rdpDumpStats(Rdp* pRDP);
+#endif
 bool rdpEvent(Rdp* pRDP, s32 nEvent, void* pArgument);
 
 extern _XL_OBJECTTYPE gClassRDP;
@@ -5,6 +5,11 @@
 #include "emulator/xlFileGCN.h"
 #include "emulator/xlObject.h"
 
+#ifdef SIM_PERF
+// Largest number of 8 KiB blocks loaded with a single DVD read
+#define ROM_EXTENT_BLOCKS_MAX 8
+#endif
+
 typedef bool UnknownCallbackFunc(void);
 typedef bool ProgressCallbackFunc(f32 progressPercent);
 
@@ -21,6 +26,14 @@ typedef enum RomTokenType {
     RTT_LAST_ = 7,
 } RomTokenType;
 
+#ifdef SIM_PERF
+typedef enum RomByteOrder {
+    RBO_NONE = 0, // .z64, big-endian
+    RBO_SWAP16 = 1, // .v64, bytes swapped within each halfword
+    RBO_SWAP32 = 2, // .n64, bytes swapped within each word
+} RomByteOrder;
+#endif
+
 // __anon_0x4CF87
 typedef enum RomModeLoad {
     RLM_NONE = -1,
@@ -42,6 +55,9 @@ typedef struct RomBlock {
     /* 0x04 */ u32 nSize;
     /* 0x08 */ u32 nTickUsed;
     /* 0x0C */ s8 keep;
+#ifdef SIM_PERF
+    /* 0x0D */ s8 bTransfer; // Set while an ARAM transfer of this block is queued or in flight
+#endif
 } RomBlock; // size = 0x10
 
 // __anon_0x4D0FA
@@ -67,7 +83,44 @@ typedef struct RomLoadState {
     /* 0x24 */ u32 nOffset1;
     /* 0x28 */ u32 nSize;
     /* 0x2C */ u32 nSizeRead;
+#ifdef SIM_PERF
+    /* 0x30 */ s32 nCountBlock; // Number of consecutive blocks in this extent
+    /* 0x34 */ s32 aiCache[ROM_EXTENT_BLOCKS_MAX]; // RAM cache index of each block when `nCountBlock` > 1
+} RomLoadState; // size = 0x54
+
+// Extent size, in blocks, used to load a region of the ROM
+typedef struct RomExtentRange {
+    /* 0x0 */ u32 nOffset0;
+    /* 0x4 */ u32 nOffset1;
+    /* 0x8 */ s32 nCountBlock;
+} RomExtentRange; // size = 0xC
+
+typedef struct RomStats {
+    /* 0x00 */ u32 nCountRead; // DVD requests
+    /* 0x04 */ u32 nSizeRead;
+    /* 0x08 */ u32 nCountHit; // Block lookups served from the RAM or ARAM cache
+    /* 0x0C */ u32 nCountMiss;
+} RomStats; // size = 0x10
+
+typedef struct RomTransfer {
+    /* 0x00 */ s32 iBlock;
+    /* 0x04 */ s32 iCacheRAM;
+    /* 0x08 */ s32 iCacheARAM;
+    /* 0x0C */ RomCacheType eType; // Destination cache
+    /* 0x10 */ u32 nTickUsed; // Block tick when the transfer was posted
+    /* 0x14 */ UnknownCallbackFunc* pCallback;
+} RomTransfer; // size = 0x18
+
+// Only one ARAM DMA can run at a time, so one transfer is in flight while the next one waits
+typedef struct RomTransferQueue {
+    /* 0x00 */ bool bActive;
+    /* 0x04 */ s32 iHead;
+    /* 0x08 */ s32 nCount;
+    /* 0x0C */ RomTransfer aTransfer[2];
+} RomTransferQueue; // size = 0x3C
+#else
 } RomLoadState; // size = 0x30
+#endif
 
 #if VERSION == CE_P
 // __anon_0x504C3
@@ -78,11 +131,27 @@ typedef struct RomTagFile {
 } RomTagFile; // size = 0x10
 #endif
 
+#ifdef SIM_PERF
+typedef struct RomTraceBlock {
+    /* 0x0 */ u32 nTimeFirst; // milliseconds since tracing started
+    /* 0x4 */ u32 nCount;
+} RomTraceBlock; // size = 0x8
+
+typedef struct RomTrace {
+    /* 0x0000 */ OSTick nTickStart;
+    /* 0x0004 */ RomTraceBlock aBlock[4096];
+} RomTrace; // size = 0x8004
+#endif
+
 // __anon_0x4D873
 typedef struct Rom {
     /* 0x00000 */ void* pHost;
     /* 0x00004 */ void* pBuffer;
+#ifdef SIM_PERF
+    /* 0x00008 */ RomByteOrder eByteOrder;
+#else
     /* 0x00008 */ bool bFlip;
+#endif
     /* 0x0000C */ bool bLoad;
     /* 0x00010 */ char acNameFile[513];
     /* 0x00214 */ u32 nSize;
@@ -94,18 +163,47 @@ typedef struct Rom {
     /* 0x10624 */ u8 anBlockCachedARAM[2046]; // Bitfield, one bit per block
     /* 0x10E24 */ RomCopyState copy;
     /* 0x10E38 */ RomLoadState load;
+#ifdef SIM_PERF
+    /* 0x10E8C */ s32 nCountBlockRAM;
+    /* 0x10E90 */ s32 nSizeCacheRAM;
+    /* 0x10E94 */ u8 acHeader[64];
+    /* 0x10ED4 */ u32* anOffsetBlock;
+    /* 0x10ED8 */ s32 nCountOffsetBlocks;
+#else
     /* 0x10E68 */ s32 nCountBlockRAM;
     /* 0x10E6C */ s32 nSizeCacheRAM;
     /* 0x10E70 */ u8 acHeader[64];
     /* 0x10EB0 */ u32* anOffsetBlock;
     /* 0x10EB4 */ s32 nCountOffsetBlocks;
+#endif
 #if VERSION == CE_P
+#ifdef SIM_PERF
+    /* 0x10EDC */ RomTagFile tagFile;
+    /* 0x10EEC */ u32 nChecksum;
+#else
     /* 0x10EB8 */ RomTagFile tagFile;
     /* 0x10EC8 */ u32 nChecksum;
 #endif
+#endif
+#ifdef SIM_PERF
+    /* 0x10EF0 */ DVDFileInfo fileInfo;
+    /* 0x10F2C */ s32 offsetToRom;
+    /* 0x10F30 */ u32 anPinRange[128]; // Pairs of inclusive [begin, end] ROM offsets, loaded from "<code>.PIN"
+    /* 0x11130 */ s32 nCountPinRange;
+    /* 0x11134 */ RomTrace* pTrace;
+    /* 0x11138 */ RomTransferQueue transfer;
+    /* 0x11174 */ RomExtentRange aExtent[16];
+    /* 0x11234 */ s32 nCountExtent;
+    /* 0x11238 */ s32 nCountBlockExtent; // Extent size, in blocks, outside of `aExtent`
+    /* 0x1123C */ u8* pExtentBuffer;
+    /* 0x11240 */ RomStats stats;
+    /* 0x11250 */ s32 iBlockWait; // Block the pending copy waited on, already counted in `stats`
+} Rom; // size = 0x11240, 0x11254 on CE_P
+#else
     /* 0x10ECC */ DVDFileInfo fileInfo;
     /* 0x10F08 */ s32 offsetToRom;
 } Rom; // size = 0x10EF8, 0x10F0C on CE_P
+#endif
 
 bool romGetPC(Rom* pROM, u64* pnPC);
 bool romGetCode(Rom* pROM, char* acCode);
@@ -119,6 +217,12 @@ bool romCopyImmediate(Rom* pROM, void* pTarget, s32 nOffsetROM, s32 nSize);
 bool romUpdate(Rom* pROM);
 bool romSetCacheSize(Rom* pROM, s32 nSize);
 bool romSetImage(Rom* pROM, char* szNameFile);
+#ifdef SIM_PERF
+bool romSetExtentSize(Rom* pROM, s32 nSize);
+bool romSetTrace(Rom* pROM, bool bTrace);
+bool romDumpTrace(Rom* pROM);
+bool romDumpStats(Rom* pROM);
+#endif
 bool romGetImage(Rom* pROM, char* acNameFile);
 bool romEvent(Rom* pROM, s32 nEvent, void* pArgument);
 
@@ -118,6 +118,16 @@ typedef enum SystemInterruptType {
     SIT_COUNT = 16,
 } SystemInterruptType;
 
+#ifdef SIM_PERF
+// Bit of a pending interrupt in `System::nMaskException`, so `__cntlzw` yields the type
+#define SYSTEM_INTERRUPT_BIT(eType) (0x80000000 >> (eType))
+
+// Frames between statistics dumps, or 0 for none (set with `configure.py --perf-stats`)
+#ifndef SIM_PERF_STATS
+#define SIM_PERF_STATS 0
+#endif
+#endif
+
 // __anon_0x393FF
 typedef struct SystemException {
     /* 0x00 */ char* szType;
@@ -146,9 +156,21 @@ typedef struct System {
     /* 0x24 */ void* apObject[SOT_COUNT];
     /* 0x68 */ u64 nAddressBreak;
     /* 0x70 */ SystemObjectType storageDevice;
+#ifdef SIM_PERF
+    /* 0x74 */ u32 nMaskException;
+    /* 0x78 */ bool bJapaneseVersion;
+    /* 0x7C */ u32 anCountInterrupt[16];
+    /* 0xBC */ OSTick nTickInterrupt;
+    /* 0xC0 */ s32 nFrameStats;
+    /* 0xC4 */ s32 nFrameDumpStats;
+    /* 0xC8 */ u32 nFifoWrite; // CPU FIFO write pointer at the last `systemUpdateStats`
+    /* 0xCC */ u32 nSizeFifo; // Bytes written to the CPU FIFO since the last dump
+} System; // size = 0xD0
+#else
     /* 0x74 */ u8 anException[16];
     /* 0x84 */ bool bJapaneseVersion;
 } System; // size = 0x88
+#endif
 
 // __anon_0x3459E
 typedef struct SystemRomConfig {
@@ -192,6 +214,14 @@ bool systemReset(System* pSystem);
 bool systemExecute(System* pSystem, s32 nCount);
 bool systemCheckInterrupts(System* pSystem);
 bool systemExceptionPending(System* pSystem, SystemInterruptType nException);
+#ifdef SIM_PERF
+bool systemRaiseInterrupt(System* pSystem, SystemInterruptType eType);
+bool systemClearInterrupt(System* pSystem, SystemInterruptType eType);
+bool systemDumpInterrupts(System* pSystem);
+bool systemSetStatsDump(System* pSystem, s32 nFrameDump);
+bool systemUpdateStats(System* pSystem);
+bool systemDumpStats(System* pSystem);
+#endif
 bool systemEvent(System* pSystem, s32 nEvent, void* pArgument);
 
 extern _XL_OBJECTTYPE gClassSystem;
@@ -30,7 +30,15 @@ typedef struct tXL_FILE {
     /* 0x1C */ s32 iLine;
     /* 0x20 */ s32 nLineNumber;
     /* 0x24 */ DVDFileInfo info;
+#ifdef SIM_PERF
+    /* 0x60 */ s32 nOffsetBuffer; // File offset of the data held in `pBuffer`
+    /* 0x64 */ s32 nSizeBuffer; // Valid bytes in `pBuffer`, zero when nothing is buffered
+    /* 0x68 */ s32 nSizeReadAhead;
+    /* 0x6C */ s32 nCountRead; // DVD requests since the file was opened
+} tXL_FILE; // size = 0x70
+#else
 } tXL_FILE; // size = 0x60
+#endif
 #else
 typedef struct tXL_FILE {
     /* 0x00 */ s32 iBuffer;
@@ -41,8 +49,16 @@ typedef struct tXL_FILE {
     /* 0x14 */ s32 nOffset;
     /* 0x18 */ XlFileType eType;
     /* 0x1C */ DVDFileInfo info;
+#ifdef SIM_PERF
+    /* 0x58 */ s32 nOffsetBuffer; // File offset of the data held in `pBuffer`
+    /* 0x5C */ s32 nSizeBuffer; // Valid bytes in `pBuffer`, zero when nothing is buffered
+    /* 0x60 */ s32 nSizeReadAhead;
+    /* 0x64 */ s32 nCountRead; // DVD requests since the file was opened
+} tXL_FILE; // size = 0x68
+#else
 } tXL_FILE; // size = 0x58
 #endif
+#endif
 
 bool xlFileSetOpen(DVDOpenCallback pfOpen);
 bool xlFileSetRead(DVDReadCallback pfRead);
@@ -51,6 +67,10 @@ bool xlFileOpen(tXL_FILE** ppFile, XlFileType eType, char* szFileName);
 bool xlFileClose(tXL_FILE** ppFile);
 bool xlFileGet(tXL_FILE* pFile, void* pTarget, s32 nSizeBytes);
 bool xlFileSetPosition(tXL_FILE* pFile, s32 nOffset);
+#ifdef SIM_PERF
+bool xlFileSetReadAhead(tXL_FILE* pFile, s32 nSize);
+bool xlFileDumpStats(void);
+#endif
 bool xlFileEvent(tXL_FILE* pFile, s32 nEvent, void* pArgument);
 
 #endif
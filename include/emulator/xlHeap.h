@@ -6,6 +6,9 @@
 extern s32 gnSizeHeap;
 
 bool xlHeapTake(void** ppHeap, s32 nByteCount);
+#ifdef SIM_PERF
+bool xlHeapTakeSite(void** ppHeap, s32 nByteCount, char* szFile, s32 nLine);
+#endif
 bool xlHeapFree(void** ppHeap);
 bool xlHeapCompact(void);
 bool xlHeapCopy(void* pHeapTarget, void* pHeapSource, s32 nByteCount);
@@ -13,5 +16,15 @@ bool xlHeapFill32(void* pHeap, s32 nByteCount, u32 nData);
 bool xlHeapGetFree(s32* pnFreeBytes);
 bool xlHeapSetup(void* pHeap, s32 nSizeBytes);
 bool xlHeapReset(void);
+#ifdef SIM_PERF
+bool xlHeapSetTelemetry(bool bEnable);
+bool xlHeapUpdateTelemetry(void);
+bool xlHeapDumpTelemetry(void);
+
+// Build with XL_HEAP_SITES defined to attribute heap telemetry to the file and line of each take
+#ifdef XL_HEAP_SITES
+#define xlHeapTake(ppHeap, nByteCount) xlHeapTakeSite((ppHeap), (nByteCount), __FILE__, __LINE__)
+#endif
+#endif
 
 #endif
@@ -6,13 +6,27 @@
 // List nodes consist of a pointer to the next node followed by an arbitrary amount of data.
 #define NODE_NEXT(pNode) (*(void**)(pNode))
 #define NODE_DATA(pNode) (((u8*)(pNode) + 4))
+#ifdef SIM_PERF
+// In front of each node sit a pointer to the previous node and a tag naming the list that owns the node.
+#define NODE_PREVIOUS(pNode) (((void**)(pNode))[-2])
+#define NODE_TAG(pNode) (((u32*)(pNode))[-1])
+#define NODE_FROM_DATA(pData) ((void*)((u8*)(pData) - 4))
+
+// Freed nodes have their tag cleared, so a node is only valid if its tag matches its list
+#define NODE_TAG_LIST(pList) ((u32)(pList) ^ 0x584C4C54)
+#endif
 
 typedef struct tXL_LIST {
     /* 0x0 */ s32 nItemSize;
     /* 0x4 */ s32 nItemCount;
     /* 0x8 */ void* pNodeHead;
     /* 0xC */ void* pNodeNext;
+#ifdef SIM_PERF
+    /* 0x10 */ void* pNodeTail;
+} tXL_LIST; // size = 0x14
+#else
 } tXL_LIST; // size = 0x10
+#endif
 
 bool xlListMake(tXL_LIST** ppList, s32 nItemSize);
 bool xlListFree(tXL_LIST** ppList);
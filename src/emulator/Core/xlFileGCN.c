@@ -18,6 +18,12 @@ _XL_OBJECTTYPE gTypeFile = {
 static DVDOpenCallback gpfOpen;
 static DVDReadCallback gpfRead;
 
+#ifdef SIM_PERF
+// Files closed and their DVD requests since the last `xlFileDumpStats`
+static s32 gnCountFileClosed;
+static s32 gnCountReadClosed;
+#endif
+
 bool xlFileSetOpen(DVDOpenCallback pfOpen) {
     gpfOpen = pfOpen;
     return true;
@@ -82,6 +88,67 @@ bool xlFileClose(tXL_FILE** ppFile) {
     return true;
 }
 
+#ifdef SIM_PERF
+static inline void xlFileRead(tXL_FILE* pFile, void* pTarget, s32 nSize, s32 nOffset) {
+    if (gpfRead != NULL) {
+        gpfRead(pFile->pData, pTarget, nSize, nOffset, NULL);
+    } else {
+        DVDReadPrio(pFile->pData, pTarget, nSize, nOffset, 2);
+    }
+    pFile->nCountRead++;
+}
+
+// Reads are served from a window of `nSizeReadAhead` bytes kept in `pBuffer`, so small sequential reads (such as
+// the single characters read by `xlFileGetLine`) only go to the disc once per window. Large reads into aligned
+// targets bypass the window and are issued as one request.
+bool xlFileGet(tXL_FILE* pFile, void* pTarget, s32 nSizeBytes) {
+    s32 nOffset;
+    s32 nOffsetExtra;
+    s32 nSize;
+    s32 nSizeUsed;
+
+    nOffset = pFile->nOffset;
+    nSize = pFile->nSize;
+    if (nOffset + nSizeBytes > nSize) {
+        nSizeBytes = nSize - nOffset;
+    }
+    if (nSizeBytes == 0) {
+        *(s8*)pTarget = 0xFF;
+        return false;
+    }
+
+    while (nSizeBytes != 0) {
+        nOffsetExtra = pFile->nOffset - pFile->nOffsetBuffer;
+        if (nOffsetExtra >= 0 && nOffsetExtra < pFile->nSizeBuffer) {
+            nSizeUsed = pFile->nSizeBuffer - nOffsetExtra;
+            if (nSizeUsed > nSizeBytes) {
+                nSizeUsed = nSizeBytes;
+            }
+            if (!xlHeapCopy(pTarget, (void*)((u8*)pFile->pBuffer + nOffsetExtra), nSizeUsed)) {
+                return false;
+            }
+        } else if (nSizeBytes >= pFile->nSizeReadAhead && !((u32)pTarget & 0x1F) && !(pFile->nOffset & 0x3)) {
+            nSizeUsed = nSizeBytes & ~0x1F;
+            DCInvalidateRange(pTarget, nSizeUsed);
+            xlFileRead(pFile, pTarget, nSizeUsed, pFile->nOffset);
+        } else {
+            nOffset = pFile->nOffset & ~0x3;
+            if ((nSize = pFile->nSize - nOffset) > pFile->nSizeReadAhead) {
+                nSize = pFile->nSizeReadAhead;
+            }
+            xlFileRead(pFile, pFile->pBuffer, (nSize + 0x1F) & ~0x1F, nOffset);
+            pFile->nOffsetBuffer = nOffset;
+            pFile->nSizeBuffer = nSize;
+            continue;
+        }
+
+        pTarget = (void*)((s32)pTarget + nSizeUsed);
+        nSizeBytes -= nSizeUsed;
+        pFile->nOffset += nSizeUsed;
+    }
+    return true;
+}
+#else
 bool xlFileGet(tXL_FILE* pFile, void* pTarget, s32 nSizeBytes) {
     s32 nOffset;
     s32 nOffsetExtra;
@@ -120,6 +187,7 @@ bool xlFileGet(tXL_FILE* pFile, void* pTarget, s32 nSizeBytes) {
     }
     return true;
 }
+#endif
 
 bool xlFileSetPosition(tXL_FILE* pFile, s32 nOffset) {
     if ((nOffset >= 0) && (nOffset < pFile->nSize)) {
@@ -130,6 +198,38 @@ bool xlFileSetPosition(tXL_FILE* pFile, s32 nOffset) {
     return false;
 }
 
+#ifdef SIM_PERF
+// Resizes the read-ahead window; on failure the file keeps its current window
+bool xlFileSetReadAhead(tXL_FILE* pFile, s32 nSize) {
+    void* pBuffer;
+
+    nSize = (nSize + 0x1F) & ~0x1F;
+    if (nSize < 0x20) {
+        nSize = 0x20;
+    }
+
+    if (!xlHeapTake(&pBuffer, (nSize + 0x24) | 0x30000000)) {
+        return false;
+    }
+    if (!xlHeapFree(&pFile->pBuffer)) {
+        xlHeapFree(&pBuffer);
+        return false;
+    }
+
+    pFile->pBuffer = pBuffer;
+    pFile->nSizeBuffer = 0;
+    pFile->nSizeReadAhead = nSize;
+    return true;
+}
+
+bool xlFileDumpStats(void) {
+    OSReport("XLFILE %d files closed, %d DVD reads\n", gnCountFileClosed, gnCountReadClosed);
+    gnCountFileClosed = 0;
+    gnCountReadClosed = 0;
+    return true;
+}
+#endif
+
 #if VERSION == CE_P
 s32 xlFileGetPosition(tXL_FILE* pFile, s32* pnOffset) {
     if (pnOffset != NULL) {
@@ -147,6 +247,12 @@ bool xlFileEvent(tXL_FILE* pFile, s32 nEvent, void* pArgument) {
             pFile->pData = NULL;
 #if VERSION == CE_P
             pFile->acLine = NULL;
+#endif
+#ifdef SIM_PERF
+            pFile->nOffsetBuffer = 0;
+            pFile->nSizeBuffer = 0;
+            pFile->nSizeReadAhead = 0x1000;
+            pFile->nCountRead = 0;
 #endif
             if (!xlHeapTake(&pFile->pBuffer, 0x1024 | 0x30000000)) {
                 return false;
@@ -159,6 +265,10 @@ bool xlFileEvent(tXL_FILE* pFile, s32 nEvent, void* pArgument) {
             }
 #endif
             DVDClose(&pFile->info);
+#ifdef SIM_PERF
+            gnCountFileClosed++;
+            gnCountReadClosed += pFile->nCountRead;
+#endif
             if (!xlHeapFree(&pFile->pBuffer)) {
                 return false;
             }
@@ -1,4 +1,15 @@
 #include "emulator/xlHeap.h"
+#ifdef SIM_PERF
+#include "macros.h"
+
+#undef xlHeapTake
+
+// Free blocks are kept in segregated free lists, indexed with a two-level bitmap
+// (first level: power of two of the size, second level: eight linear steps)
+#define HEAP_LIST_SHIFT 3
+#define HEAP_LIST_COUNT_SL (1 << HEAP_LIST_SHIFT)
+#define HEAP_LIST_COUNT_FL 21
+#endif
 
 static u32* gpHeap;
 static u32* gpHeapBlockFirst;
@@ -6,26 +17,608 @@ static u32* gpHeapBlockLast;
 static s32 gnHeapTakeCount;
 static s32 gnHeapFreeCount;
 static s32 gnHeapTakeCacheCount;
+#ifdef SIM_PERF
+static u32 gnHeapListMaskFL;
+static u32 ganHeapListMaskSL[HEAP_LIST_COUNT_FL];
+static u32* gapHeapList[HEAP_LIST_COUNT_FL][HEAP_LIST_COUNT_SL];
+#else
 static u32* gapHeapBlockCache[11][32];
+#endif
+
 s32 gnSizeHeap;
+#ifdef SIM_PERF
+typedef struct XlHeapSite {
+    /* 0x00 */ char* szFile; // NULL for takes made without `XL_HEAP_SITES`
+    /* 0x04 */ s32 nLine;
+    /* 0x08 */ s32 nCountTake;
+    /* 0x0C */ s32 nCountFail;
+    /* 0x10 */ u32 nSizeTake;
+} XlHeapSite; // size = 0x14
+
+typedef struct XlHeapSnapshot {
+    /* 0x00 */ u32 nFrame;
+    /* 0x04 */ s32 nSizeFree;
+    /* 0x08 */ s32 nSizeFreeLargest;
+    /* 0x0C */ s32 nCountFree;
+    /* 0x10 */ s32 nCountTaken;
+    /* 0x14 */ s32 nFragment; // 1000 * (1 - largest free block / total free)
+    /* 0x18 */ s32 anCountSize[16]; // Taken blocks by size, from <= 16 bytes up in powers of two
+} XlHeapSnapshot; // size = 0x58
+
+typedef struct XlHeapTelemetry {
+    /* 0x000 */ u32 nFrame;
+    /* 0x004 */ s32 nCountTake;
+    /* 0x008 */ s32 nCountFree;
+    /* 0x00C */ s32 nCountFail;
+    /* 0x010 */ s32 iSnapshot;
+    /* 0x014 */ XlHeapSnapshot aSnapshot[8];
+    /* 0x2D4 */ XlHeapSite aSite[64];
+} XlHeapTelemetry; // size = 0x7D4
+
+static XlHeapTelemetry* gpHeapTelemetry;
+#endif
 
 #define PADDING_MAGIC 0x1234abcd
 
+#ifdef SIM_PERF
+#define FLAG_PREVIOUS_FREE 0x00800000
+#endif
 #define FLAG_FREE 0x01000000
 #define FLAG_TAKEN 0x02000000
 
 // Blocks have a 32-bit header:
+#ifdef SIM_PERF
+//   copy low bits of size (6 bits) | flags (2 bits) | previous block is free (1 bit) | size (23 bits)
+#else
 //   copy low bits of size (6 bits) | flags (2 bits) | size (26 bits)
+#endif
 #define MAKE_BLOCK(size, flags) ((size) | ((size) << 26) | (flags))
 
 #define BLOCK_IS_FREE(v) ((v) & FLAG_FREE)
 #define BLOCK_IS_TAKEN(v) ((v) & FLAG_TAKEN)
+#ifdef SIM_PERF
+#define BLOCK_IS_PREVIOUS_FREE(v) ((v) & FLAG_PREVIOUS_FREE)
+#define BLOCK_SIZE(v) ((s32)((v) & 0x7FFFFF))
+#define BLOCK_SIZE_MAX 0x7FFFFF
+
+// Free blocks link to their neighbours in the free list with the first two words
+// and repeat their size in the last word, so a block being freed can find them
+#define BLOCK_SIZE_MIN 3
+#define BLOCK_LIST_NEXT(pBlock) ((u32*)(pBlock)[1])
+#define BLOCK_LIST_PREVIOUS(pBlock) ((u32*)(pBlock)[2])
+#else
 #define BLOCK_SIZE(v) ((s32)((v) & 0xFFFFFF))
+#endif
 
 //! TODO: these need better names
 #define CHKSUM_HI(v) ((u32)((v) >> 26))
 #define CHKSUM_LO(v) ((u32)((v) & 0x3F))
+#ifdef SIM_PERF
+static inline void xlHeapListIndex(s32 nSize, s32* piListFL, s32* piListSL) {
+    s32 nShift;
+
+    if (nSize < HEAP_LIST_COUNT_SL) {
+        *piListFL = 0;
+        *piListSL = nSize;
+    } else {
+        nShift = 31 - __cntlzw(nSize);
+        *piListFL = nShift - (HEAP_LIST_SHIFT - 1);
+        *piListSL = (nSize >> (nShift - HEAP_LIST_SHIFT)) & (HEAP_LIST_COUNT_SL - 1);
+    }
+}
+
+static void xlHeapListAdd(u32* pBlock, s32 nSize) {
+    s32 iListFL;
+    s32 iListSL;
+    u32* pBlockNext;
+
+    xlHeapListIndex(nSize, &iListFL, &iListSL);
+
+    pBlockNext = gapHeapList[iListFL][iListSL];
+    pBlock[1] = (u32)pBlockNext;
+    pBlock[2] = (u32)NULL;
+    if (pBlockNext != NULL) {
+        pBlockNext[2] = (u32)pBlock;
+    }
+    gapHeapList[iListFL][iListSL] = pBlock;
+
+    gnHeapListMaskFL |= 1 << iListFL;
+    ganHeapListMaskSL[iListFL] |= 1 << iListSL;
+    pBlock[nSize] = nSize;
+}
+
+static void xlHeapListRemove(u32* pBlock, s32 nSize) {
+    s32 iListFL;
+    s32 iListSL;
+    u32* pBlockNext;
+    u32* pBlockPrevious;
+
+    xlHeapListIndex(nSize, &iListFL, &iListSL);
+
+    pBlockNext = BLOCK_LIST_NEXT(pBlock);
+    pBlockPrevious = BLOCK_LIST_PREVIOUS(pBlock);
+    if (pBlockNext != NULL) {
+        pBlockNext[2] = (u32)pBlockPrevious;
+    }
+    if (pBlockPrevious != NULL) {
+        pBlockPrevious[1] = (u32)pBlockNext;
+    } else {
+        gapHeapList[iListFL][iListSL] = pBlockNext;
+        if (pBlockNext == NULL) {
+            if ((ganHeapListMaskSL[iListFL] &= ~(1 << iListSL)) == 0) {
+                gnHeapListMaskFL &= ~(1 << iListFL);
+            }
+        }
+    }
+}
+
+// Finds a free block of at least `nSize` words in O(1) by rounding the size up
+// to the next list, so that every block in the chosen list is large enough.
+static bool xlHeapListFind(s32 nSize, u32** ppBlock, s32* pnBlockSize) {
+    s32 iListFL;
+    s32 iListSL;
+    u32 nMask;
+    u32* pBlock;
+
+    if (nSize >= HEAP_LIST_COUNT_SL) {
+        nSize += (1 << ((31 - __cntlzw(nSize)) - HEAP_LIST_SHIFT)) - 1;
+    }
+    xlHeapListIndex(nSize, &iListFL, &iListSL);
+    if (iListFL >= HEAP_LIST_COUNT_FL) {
+        return false;
+    }
+
+    nMask = ganHeapListMaskSL[iListFL] & (0xFFFFFFFF << iListSL);
+    if (nMask == 0) {
+        if (iListFL + 1 >= HEAP_LIST_COUNT_FL || (nMask = gnHeapListMaskFL & (0xFFFFFFFF << (iListFL + 1))) == 0) {
+            return false;
+        }
+        iListFL = 31 - __cntlzw(nMask & -nMask);
+        nMask = ganHeapListMaskSL[iListFL];
+    }
+    iListSL = 31 - __cntlzw(nMask & -nMask);
+
+    pBlock = gapHeapList[iListFL][iListSL];
+    *pnBlockSize = BLOCK_SIZE(*pBlock);
+    *ppBlock = pBlock;
+
+    xlHeapListRemove(pBlock, *pnBlockSize);
+    gnHeapTakeCacheCount++;
+    return true;
+}
+
+static bool xlHeapListReset(void) {
+    s32 iListFL;
+    s32 iListSL;
+    s32 nBlockSize;
+    u32* pBlock;
+    u32 nFlagPrevious;
+
+    gnHeapTakeCacheCount = 0;
+    gnHeapFreeCount = 0;
+    gnHeapTakeCount = 0;
+
+    gnHeapListMaskFL = 0;
+    for (iListFL = 0; iListFL < HEAP_LIST_COUNT_FL; iListFL++) {
+        ganHeapListMaskSL[iListFL] = 0;
+        for (iListSL = 0; iListSL < HEAP_LIST_COUNT_SL; iListSL++) {
+            gapHeapList[iListFL][iListSL] = NULL;
+        }
+    }
+
+    nFlagPrevious = 0;
+    pBlock = gpHeapBlockFirst;
+    while ((nBlockSize = BLOCK_SIZE(*pBlock)) != 0) {
+        *pBlock = (*pBlock & ~FLAG_PREVIOUS_FREE) | nFlagPrevious;
+        if (BLOCK_IS_FREE(*pBlock)) {
+            xlHeapListAdd(pBlock, nBlockSize);
+            nFlagPrevious = FLAG_PREVIOUS_FREE;
+        } else {
+            nFlagPrevious = 0;
+        }
+        pBlock += nBlockSize + 1;
+    }
+    *pBlock = nFlagPrevious;
+
+    return true;
+}
+
+// Upper blocks are carved from the end of the free block with the highest address,
+// which keeps long-lived allocations away from the churn at the bottom of the heap.
+static bool xlHeapFindUpperBlock(s32 nSize, u32** ppBlock, s32* pnBlockSize) {
+    s32 iListFL;
+    s32 iListSL;
+    s32 nBlockSize;
+    u32* pBlock;
+    u32* pBlockBest;
+    u32* pBlockNext;
+
+    pBlockBest = NULL;
+    for (iListFL = 0; iListFL < HEAP_LIST_COUNT_FL; iListFL++) {
+        if (!(gnHeapListMaskFL & (1 << iListFL))) {
+            continue;
+        }
+        for (iListSL = 0; iListSL < HEAP_LIST_COUNT_SL; iListSL++) {
+            for (pBlock = gapHeapList[iListFL][iListSL]; pBlock != NULL; pBlock = BLOCK_LIST_NEXT(pBlock)) {
+                if (CHKSUM_LO(*pBlock) != CHKSUM_HI(*pBlock)) {
+                    return false;
+                }
+                if (BLOCK_SIZE(*pBlock) >= nSize && (u32)pBlock > (u32)pBlockBest) {
+                    pBlockBest = pBlock;
+                }
+            }
+        }
+    }
+
+    if (pBlockBest == NULL) {
+        return false;
+    }
+
+    nBlockSize = BLOCK_SIZE(*pBlockBest);
+    xlHeapListRemove(pBlockBest, nBlockSize);
+
+    if (nBlockSize > nSize + 0x20) {
+        pBlockNext = pBlockBest + (nBlockSize - nSize);
+        *pBlockNext = MAKE_BLOCK(nSize, FLAG_FREE | FLAG_PREVIOUS_FREE);
+        nBlockSize -= nSize + 1;
+        *pBlockBest = MAKE_BLOCK(nBlockSize, FLAG_FREE | BLOCK_IS_PREVIOUS_FREE(*pBlockBest));
+        xlHeapListAdd(pBlockBest, nBlockSize);
+        *ppBlock = pBlockNext;
+        *pnBlockSize = nSize;
+    } else {
+        *ppBlock = pBlockBest;
+        *pnBlockSize = nBlockSize;
+    }
+    return true;
+}
+
+static bool xlHeapTakeBlock(void** ppHeap, s32 nByteCount) {
+    bool bValid;
+    u32 nSizeExtra;
+    s32 nSize;
+    s32 nBlockSize;
+    s32 nBlockNextSize;
+    u32* pBlock;
+    u32* pBlockNext;
+
+    *ppHeap = NULL;
+
+    switch (nByteCount & 0x30000000) {
+        case 0:
+            nSizeExtra = 3;
+            break;
+        case 0x10000000:
+            nSizeExtra = 7;
+            break;
+        case 0x20000000:
+            nSizeExtra = 15;
+            break;
+        case 0x30000000:
+            nSizeExtra = 31;
+            break;
+    }
+
+    if ((nSize = ((nByteCount & 0x8FFFFFFF) + nSizeExtra) >> 2) < 1) {
+        return false;
+    }
+    if (nSize > BLOCK_SIZE_MAX) {
+        return false;
+    }
+    if (nSize < BLOCK_SIZE_MIN) {
+        nSize = BLOCK_SIZE_MIN;
+    }
+
+    if (nByteCount & 0x40000000) {
+        bValid = xlHeapFindUpperBlock(nSize, &pBlock, &nBlockSize);
+    } else {
+        bValid = xlHeapListFind(nSize, &pBlock, &nBlockSize);
+    }
+    if (!bValid) {
+        return false;
+    }
+
+    if (CHKSUM_LO(*pBlock) != CHKSUM_HI(*pBlock)) {
+        return false;
+    }
+
+    // Split off the rest of the block unless it is too small to hold a free list entry
+    pBlockNext = pBlock + nBlockSize + 1;
+    if (nBlockSize - nSize - 1 >= BLOCK_SIZE_MIN) {
+        nBlockNextSize = nBlockSize - nSize - 1;
+        pBlockNext = pBlock + nSize + 1;
+        *pBlockNext = MAKE_BLOCK(nBlockNextSize, FLAG_FREE);
+        xlHeapListAdd(pBlockNext, nBlockNextSize);
+    } else {
+        nSize = nBlockSize;
+        *pBlockNext &= ~FLAG_PREVIOUS_FREE;
+    }
+
+    *pBlock = MAKE_BLOCK(nSize, FLAG_TAKEN | BLOCK_IS_PREVIOUS_FREE(*pBlock));
+    gnHeapTakeCount += 1;
+
+    pBlock++;
+    while (((u32)pBlock & nSizeExtra) != 0) {
+        *pBlock++ = PADDING_MAGIC;
+    }
+
+    *ppHeap = pBlock;
+    return true;
+}
+
+static void xlHeapTelemetryTake(char* szFile, s32 nLine, s32 nByteCount, bool bValid) {
+    s32 iSite;
+    s32 nCount;
+    XlHeapSite* pSite;
+
+    // Sites are hashed by line number; once the table is full new sites only show up in the totals
+    iSite = nLine & (ARRAY_COUNT(gpHeapTelemetry->aSite) - 1);
+    for (nCount = 0; nCount < ARRAY_COUNT(gpHeapTelemetry->aSite); nCount++) {
+        pSite = &gpHeapTelemetry->aSite[iSite];
+        if (pSite->szFile == szFile && pSite->nLine == nLine) {
+            break;
+        }
+        if (pSite->nCountTake == 0 && pSite->nCountFail == 0) {
+            pSite->szFile = szFile;
+            pSite->nLine = nLine;
+            break;
+        }
+        iSite = (iSite + 1) & (ARRAY_COUNT(gpHeapTelemetry->aSite) - 1);
+    }
+    if (nCount == ARRAY_COUNT(gpHeapTelemetry->aSite)) {
+        pSite = NULL;
+    }
+
+    if (bValid) {
+        gpHeapTelemetry->nCountTake++;
+        if (pSite != NULL) {
+            pSite->nCountTake++;
+            pSite->nSizeTake += nByteCount & 0x0FFFFFFF;
+        }
+    } else {
+        gpHeapTelemetry->nCountFail++;
+        if (pSite != NULL) {
+            pSite->nCountFail++;
+        }
+        OSReport("XLHEAP take failed: %d bytes at %s:%d\n", nByteCount & 0x0FFFFFFF, szFile == NULL ? "?" : szFile,
+                 nLine);
+    }
+}
+
+bool xlHeapTakeSite(void** ppHeap, s32 nByteCount, char* szFile, s32 nLine) {
+    bool bValid;
+
+    bValid = xlHeapTakeBlock(ppHeap, nByteCount);
+    if (gpHeapTelemetry != NULL) {
+        xlHeapTelemetryTake(szFile, nLine, nByteCount, bValid);
+    }
+
+    return bValid;
+}
+
+bool xlHeapTake(void** ppHeap, s32 nByteCount) { return xlHeapTakeSite(ppHeap, nByteCount, NULL, 0); }
+
+bool xlHeapFree(void** ppHeap) {
+    s32 nBlockSize;
+    s32 nBlockNextSize;
+    s32 nBlockPreviousSize;
+    u32* pBlock;
+    u32* pBlockNext;
+
+    if (ppHeap == NULL || (u32)*ppHeap < (u32)gpHeapBlockFirst || (u32)*ppHeap > (u32)gpHeapBlockLast) {
+        return false;
+    }
+
+    pBlock = (u32*)*ppHeap - 1;
+    while (*pBlock == PADDING_MAGIC) {
+        pBlock--;
+    }
+
+    nBlockSize = BLOCK_SIZE(*pBlock);
+    if (BLOCK_IS_FREE(*pBlock)) {
+        return false;
+    }
+
+    if (!BLOCK_IS_TAKEN(*pBlock)) {
+        return false;
+    }
+
+    if (CHKSUM_HI(*pBlock) != CHKSUM_LO(nBlockSize)) {
+        return false;
+    }
+
+    // Neighbours are only merged while the size still fits in the block header
+    pBlockNext = pBlock + nBlockSize + 1;
+    if ((nBlockNextSize = BLOCK_SIZE(*pBlockNext)) != 0 && BLOCK_IS_FREE(*pBlockNext) &&
+        nBlockSize + nBlockNextSize + 1 <= BLOCK_SIZE_MAX) {
+        xlHeapListRemove(pBlockNext, nBlockNextSize);
+        nBlockSize += nBlockNextSize + 1;
+        pBlockNext += nBlockNextSize + 1;
+    }
+
+    if (BLOCK_IS_PREVIOUS_FREE(*pBlock) && nBlockSize + pBlock[-1] + 1 <= BLOCK_SIZE_MAX) {
+        nBlockPreviousSize = pBlock[-1];
+        pBlock -= nBlockPreviousSize + 1;
+        xlHeapListRemove(pBlock, nBlockPreviousSize);
+        nBlockSize += nBlockPreviousSize + 1;
+    }
+
+    *pBlock = MAKE_BLOCK(nBlockSize, FLAG_FREE | BLOCK_IS_PREVIOUS_FREE(*pBlock));
+    *pBlockNext |= FLAG_PREVIOUS_FREE;
+    xlHeapListAdd(pBlock, nBlockSize);
+
+    gnHeapFreeCount++;
+    if (gpHeapTelemetry != NULL) {
+        gpHeapTelemetry->nCountFree++;
+    }
+    *ppHeap = NULL;
+
+    return true;
+}
+
+// Free blocks are merged as they are released, so this only has to rebuild the free
+// lists (merging any neighbours that slipped through, e.g. after a heap reset).
+bool xlHeapCompact(void) {
+    s32 nBlockSize;
+    u32* pBlock;
+    u32* pBlockPrevious;
+    u32* pBlockNext;
+
+    pBlockPrevious = NULL;
+    pBlock = gpHeapBlockFirst;
+    while ((nBlockSize = BLOCK_SIZE(*pBlock)) != 0) {
+        pBlockNext = pBlock + nBlockSize + 1;
+
+        if (BLOCK_IS_FREE(*pBlock) && pBlockPrevious != NULL && BLOCK_IS_FREE(*pBlockPrevious) &&
+            BLOCK_SIZE(*pBlockPrevious) + nBlockSize + 1 <= BLOCK_SIZE_MAX) {
+            nBlockSize += BLOCK_SIZE(*pBlockPrevious) + 1;
+            *pBlockPrevious = MAKE_BLOCK(nBlockSize, FLAG_FREE);
+        } else {
+            pBlockPrevious = pBlock;
+        }
+        pBlock = pBlockNext;
+    }
+
+    xlHeapListReset();
+    return true;
+}
+
+// Copies and fills at least this large work on whole 32-byte cache lines
+#define HEAP_LINE_MIN 256
+
+// Gekko copies 8 bytes at a time through the FPU (lfd/stfd move the bits unchanged)
+#ifdef __MWERKS__
+typedef f64 XlHeapWide;
+#else
+typedef u64 XlHeapWide;
+#endif
+
+typedef union XlHeapWideData {
+    /* 0x0 */ u32 an[2];
+    /* 0x0 */ XlHeapWide nWide;
+} XlHeapWideData; // size = 0x8
+
+// `dcbz` only works on cached memory, so uncached mirrors take the plain loops
+static inline bool xlHeapIsCached(void* pHeap) {
+#ifdef __MWERKS__
+    return ((u32)pHeap & 0xF0000000) == 0x80000000;
+#else
+    return true;
+#endif
+}
+
+// The FPU can only be used where it is enabled, which excludes interrupt handlers
+static inline bool xlHeapIsWide(void) {
+#ifdef __MWERKS__
+    return (PPCMfmsr() & MSR_FP) ? true : false;
+#else
+    return true;
+#endif
+}
+
+static inline void xlHeapTouchLine(register void* pLine) {
+#ifdef __MWERKS__
+    // clang-format off
+    asm {
+        dcbt r0, pLine
+    }
+    // clang-format on
+#endif
+}
+
+static inline void xlHeapZeroLine(register void* pLine) {
+#ifdef __MWERKS__
+    // clang-format off
+    asm {
+        dcbz r0, pLine
+    }
+    // clang-format on
+#else
+    ((u32*)pLine)[0] = 0;
+    ((u32*)pLine)[1] = 0;
+    ((u32*)pLine)[2] = 0;
+    ((u32*)pLine)[3] = 0;
+    ((u32*)pLine)[4] = 0;
+    ((u32*)pLine)[5] = 0;
+    ((u32*)pLine)[6] = 0;
+    ((u32*)pLine)[7] = 0;
+#endif
+}
+
+// Copies whole cache lines to a line-aligned target. Each target line is claimed with `dcbz` rather than
+// read from memory, and the next source line is prefetched while the current one is copied.
+static void xlHeapCopyLines(void* pHeapTarget, void* pHeapSource, s32 nCountLine, bool bWide) {
+    XlHeapWide* pSourceWide;
+    XlHeapWide* pTargetWide;
+    u32* pSource32;
+    u32* pTarget32;
 
+    if (bWide) {
+        pSourceWide = (XlHeapWide*)pHeapSource;
+        pTargetWide = (XlHeapWide*)pHeapTarget;
+        for (; nCountLine > 0; nCountLine--) {
+            xlHeapTouchLine(pSourceWide + 4);
+            xlHeapZeroLine(pTargetWide);
+            pTargetWide[0] = pSourceWide[0];
+            pTargetWide[1] = pSourceWide[1];
+            pTargetWide[2] = pSourceWide[2];
+            pTargetWide[3] = pSourceWide[3];
+            pTargetWide += 4;
+            pSourceWide += 4;
+        }
+    } else {
+        pSource32 = (u32*)pHeapSource;
+        pTarget32 = (u32*)pHeapTarget;
+        for (; nCountLine > 0; nCountLine--) {
+            xlHeapTouchLine(pSource32 + 8);
+            xlHeapZeroLine(pTarget32);
+            pTarget32[0] = pSource32[0];
+            pTarget32[1] = pSource32[1];
+            pTarget32[2] = pSource32[2];
+            pTarget32[3] = pSource32[3];
+            pTarget32[4] = pSource32[4];
+            pTarget32[5] = pSource32[5];
+            pTarget32[6] = pSource32[6];
+            pTarget32[7] = pSource32[7];
+            pTarget32 += 8;
+            pSource32 += 8;
+        }
+    }
+}
+
+static void xlHeapFillLines(void* pHeap, s32 nCountLine, u32 nData) {
+    XlHeapWideData data;
+    XlHeapWide* pTargetWide;
+    u32* pTarget32;
+
+    if (nData == 0) {
+        for (pTarget32 = (u32*)pHeap; nCountLine > 0; nCountLine--, pTarget32 += 8) {
+            xlHeapZeroLine(pTarget32);
+        }
+    } else if (xlHeapIsWide()) {
+        data.an[0] = nData;
+        data.an[1] = nData;
+        for (pTargetWide = (XlHeapWide*)pHeap; nCountLine > 0; nCountLine--, pTargetWide += 4) {
+            xlHeapZeroLine(pTargetWide);
+            pTargetWide[0] = data.nWide;
+            pTargetWide[1] = data.nWide;
+            pTargetWide[2] = data.nWide;
+            pTargetWide[3] = data.nWide;
+        }
+    } else {
+        for (pTarget32 = (u32*)pHeap; nCountLine > 0; nCountLine--, pTarget32 += 8) {
+            xlHeapZeroLine(pTarget32);
+            pTarget32[0] = nData;
+            pTarget32[1] = nData;
+            pTarget32[2] = nData;
+            pTarget32[3] = nData;
+            pTarget32[4] = nData;
+            pTarget32[5] = nData;
+            pTarget32[6] = nData;
+            pTarget32[7] = nData;
+        }
+    }
+}
+#else
 static bool xlHeapBlockCacheGet(s32 nSize, u32** ppBlock, s32* pnBlockSize) {
     s32 nBlockCachedSize;
     s32 nBlock;
@@ -437,16 +1030,36 @@ bool xlHeapCompact(void) {
     xlHeapBlockCacheReset();
     return true;
 }
+#endif
 
 bool xlHeapCopy(void* pHeapTarget, void* pHeapSource, s32 nByteCount) {
     u8* pSource8;
     u8* pTarget8;
     u32* pSource32;
     u32* pTarget32;
+#ifdef SIM_PERF
+    s32 nCountLine;
+#endif
 
     pSource32 = (u32*)pHeapSource;
     pTarget32 = (u32*)pHeapTarget;
     if ((u32)pSource32 % 4 == 0 && (u32)pTarget32 % 4 == 0) {
+#ifdef SIM_PERF
+        // Claiming target lines with `dcbz` would destroy unread source data if the buffers overlap
+        if (nByteCount >= HEAP_LINE_MIN && xlHeapIsCached(pTarget32) &&
+            ((u32)pTarget32 + nByteCount <= (u32)pSource32 || (u32)pSource32 + nByteCount <= (u32)pTarget32)) {
+            for (; (u32)pTarget32 % 32 != 0; nByteCount -= 4) {
+                *pTarget32++ = *pSource32++;
+            }
+
+            nCountLine = nByteCount >> 5;
+            xlHeapCopyLines(pTarget32, pSource32, nCountLine, (u32)pSource32 % 8 == 0 && xlHeapIsWide());
+            pTarget32 += nCountLine * 8;
+            pSource32 += nCountLine * 8;
+            nByteCount -= nCountLine * 32;
+        }
+#endif
+
         for (; nByteCount >= 64; nByteCount -= 64) {
             *pTarget32++ = *pSource32++;
             *pTarget32++ = *pSource32++;
@@ -524,6 +1137,20 @@ bool xlHeapCopy(void* pHeapTarget, void* pHeapSource, s32 nByteCount) {
 bool xlHeapFill32(void* pHeap, s32 nByteCount, u32 nData) {
     u32* pnTarget = pHeap;
     s32 nWordCount = nByteCount >> 2;
+#ifdef SIM_PERF
+    s32 nCountLine;
+
+    if (nByteCount >= HEAP_LINE_MIN && (u32)pnTarget % 4 == 0 && xlHeapIsCached(pnTarget)) {
+        for (; (u32)pnTarget % 32 != 0; nWordCount--) {
+            *pnTarget++ = nData;
+        }
+
+        nCountLine = nWordCount >> 3;
+        xlHeapFillLines(pnTarget, nCountLine, nData);
+        pnTarget += nCountLine * 8;
+        nWordCount -= nCountLine * 8;
+    }
+#endif
 
     for (; nWordCount > 16; nWordCount -= 16) {
         pnTarget[0] = nData;
@@ -559,9 +1186,11 @@ bool xlHeapGetFree(s32* pnFreeBytes) {
     u32* pBlock;
     u32 nBlock;
 
+#ifndef SIM_PERF
     if (!xlHeapCompact()) {
         return false;
     }
+#endif
 
     pBlock = gpHeapBlockFirst;
     nFree = 0;
@@ -630,13 +1259,179 @@ bool xlHeapSetup(void* pHeap, s32 nSizeBytes) {
 
 bool xlHeapReset(void) {
     s32 nBlockSize = (gnSizeHeap >> 2) - 2;
+#ifdef SIM_PERF
+    u32* pBlock;
+#endif
 
     gpHeapBlockFirst = gpHeap;
     gpHeapBlockLast = gpHeap + nBlockSize + 1;
 
+#ifdef SIM_PERF
+    // Heaps larger than BLOCK_SIZE_MAX words start out as several free blocks,
+    // each leaving enough words behind for the next one to hold a free list entry
+    pBlock = gpHeapBlockFirst;
+    while (nBlockSize > BLOCK_SIZE_MAX) {
+        *pBlock = MAKE_BLOCK(BLOCK_SIZE_MAX - BLOCK_SIZE_MIN, FLAG_FREE);
+        pBlock += BLOCK_SIZE_MAX - BLOCK_SIZE_MIN + 1;
+        nBlockSize -= BLOCK_SIZE_MAX - BLOCK_SIZE_MIN + 1;
+    }
+    *pBlock = MAKE_BLOCK(nBlockSize, FLAG_FREE);
+#else
     *gpHeapBlockFirst = MAKE_BLOCK(nBlockSize, FLAG_FREE);
+#endif
     *gpHeapBlockLast = 0;
 
+#ifdef SIM_PERF
+    gpHeapTelemetry = NULL;
+    xlHeapListReset();
+#else
     xlHeapBlockCacheReset();
+#endif
+    return true;
+}
+
+#ifdef SIM_PERF
+// The telemetry lives in an upper block so it stays clear of the blocks it measures.
+bool xlHeapSetTelemetry(bool bEnable) {
+    s32 iSite;
+
+    if (!bEnable) {
+        if (gpHeapTelemetry != NULL && !xlHeapFree((void**)&gpHeapTelemetry)) {
+            return false;
+        }
+        return true;
+    }
+
+    if (gpHeapTelemetry == NULL && !xlHeapTakeBlock((void**)&gpHeapTelemetry, 0x40000000 | sizeof(XlHeapTelemetry))) {
+        return false;
+    }
+
+    gpHeapTelemetry->nFrame = 0;
+    gpHeapTelemetry->nCountTake = 0;
+    gpHeapTelemetry->nCountFree = 0;
+    gpHeapTelemetry->nCountFail = 0;
+    gpHeapTelemetry->iSnapshot = 0;
+    xlHeapFill32(gpHeapTelemetry->aSnapshot, sizeof(gpHeapTelemetry->aSnapshot), 0);
+    for (iSite = 0; iSite < ARRAY_COUNT(gpHeapTelemetry->aSite); iSite++) {
+        gpHeapTelemetry->aSite[iSite].szFile = NULL;
+        gpHeapTelemetry->aSite[iSite].nLine = 0;
+        gpHeapTelemetry->aSite[iSite].nCountTake = 0;
+        gpHeapTelemetry->aSite[iSite].nCountFail = 0;
+        gpHeapTelemetry->aSite[iSite].nSizeTake = 0;
+    }
+
+    return true;
+}
+
+static bool xlHeapTelemetrySnapshot(XlHeapSnapshot* pSnapshot) {
+    s32 iSize;
+    s32 nBlockSize;
+    u32* pBlock;
+    u32 nBlock;
+
+    pSnapshot->nFrame = gpHeapTelemetry->nFrame;
+    pSnapshot->nSizeFree = 0;
+    pSnapshot->nSizeFreeLargest = 0;
+    pSnapshot->nCountFree = 0;
+    pSnapshot->nCountTaken = 0;
+    for (iSize = 0; iSize < ARRAY_COUNT(pSnapshot->anCountSize); iSize++) {
+        pSnapshot->anCountSize[iSize] = 0;
+    }
+
+    pBlock = gpHeapBlockFirst;
+    while ((u32)pBlock < (u32)gpHeapBlockLast) {
+        nBlock = *pBlock;
+        nBlockSize = BLOCK_SIZE(nBlock);
+
+        if (CHKSUM_LO(nBlock) != CHKSUM_HI(nBlock)) {
+            return false;
+        }
+
+        if (BLOCK_IS_FREE(nBlock)) {
+            pSnapshot->nCountFree++;
+            pSnapshot->nSizeFree += nBlockSize * 4;
+            if (pSnapshot->nSizeFreeLargest < nBlockSize * 4) {
+                pSnapshot->nSizeFreeLargest = nBlockSize * 4;
+            }
+        } else {
+            pSnapshot->nCountTaken++;
+            iSize = (32 - __cntlzw(nBlockSize - 1)) - 2;
+            if (iSize < 0) {
+                iSize = 0;
+            } else if (iSize >= ARRAY_COUNT(pSnapshot->anCountSize)) {
+                iSize = ARRAY_COUNT(pSnapshot->anCountSize) - 1;
+            }
+            pSnapshot->anCountSize[iSize]++;
+        }
+
+        pBlock += nBlockSize + 1;
+    }
+
+    if (pSnapshot->nSizeFree == 0) {
+        pSnapshot->nFragment = 0;
+    } else {
+        pSnapshot->nFragment = 1000 - (s32)(((s64)pSnapshot->nSizeFreeLargest * 1000) / pSnapshot->nSizeFree);
+    }
+
+    return true;
+}
+
+// Called once per frame (see `systemUpdateStats`).
+bool xlHeapUpdateTelemetry(void) {
+    if (gpHeapTelemetry != NULL) {
+        gpHeapTelemetry->nFrame++;
+    }
+
     return true;
 }
+
+bool xlHeapDumpTelemetry(void) {
+    XlHeapTelemetry* pTelemetry;
+    XlHeapSnapshot* pSnapshot;
+    XlHeapSite* pSite;
+    s32 iSnapshot;
+    s32 iSize;
+    s32 iSite;
+
+    if ((pTelemetry = gpHeapTelemetry) == NULL) {
+        return true;
+    }
+
+    // Takes a snapshot on each dump and prints it with the previous ones
+    pSnapshot = &pTelemetry->aSnapshot[pTelemetry->iSnapshot];
+    pTelemetry->iSnapshot = (pTelemetry->iSnapshot + 1) % ARRAY_COUNT(pTelemetry->aSnapshot);
+    if (!xlHeapTelemetrySnapshot(pSnapshot)) {
+        return false;
+    }
+
+    OSReport("XLHEAP frame %u: %d takes, %d frees, %d failed\n", pTelemetry->nFrame, pTelemetry->nCountTake,
+             pTelemetry->nCountFree, pTelemetry->nCountFail);
+    for (iSize = 0; iSize < ARRAY_COUNT(pSnapshot->anCountSize); iSize++) {
+        if (pSnapshot->anCountSize[iSize] != 0) {
+            OSReport("XLHEAP   taken <= %d bytes: %d\n", 16 << iSize, pSnapshot->anCountSize[iSize]);
+        }
+    }
+    for (iSite = 0; iSite < ARRAY_COUNT(pTelemetry->aSite); iSite++) {
+        pSite = &pTelemetry->aSite[iSite];
+        if (pSite->nCountTake != 0 || pSite->nCountFail != 0) {
+            OSReport("XLHEAP   site %s:%d: %d takes, %u bytes, %d failed\n",
+                     pSite->szFile == NULL ? "?" : pSite->szFile, pSite->nLine, pSite->nCountTake,
+                     pSite->nSizeTake, pSite->nCountFail);
+        }
+    }
+
+    // Recent snapshots, oldest first
+    for (iSnapshot = 0; iSnapshot < ARRAY_COUNT(pTelemetry->aSnapshot); iSnapshot++) {
+        pSnapshot = &pTelemetry->aSnapshot[(pTelemetry->iSnapshot + iSnapshot) % ARRAY_COUNT(pTelemetry->aSnapshot)];
+        if (pSnapshot->nCountTaken == 0 && pSnapshot->nCountFree == 0) {
+            continue;
+        }
+        OSReport("XLHEAP   frame %u: free %d in %d blocks, largest %d, fragmentation %d.%d%%, %d taken\n",
+                 pSnapshot->nFrame, pSnapshot->nSizeFree, pSnapshot->nCountFree, pSnapshot->nSizeFreeLargest,
+                 pSnapshot->nFragment / 10, pSnapshot->nFragment % 10, pSnapshot->nCountTaken);
+    }
+
+    return true;
+}
+#endif
+
@@ -13,6 +13,9 @@ bool xlListMake(tXL_LIST** ppList, s32 nItemSize) {
         (*ppList)->nItemSize = nItemSize;
         (*ppList)->pNodeNext = NULL;
         (*ppList)->pNodeHead = NULL;
+#ifdef SIM_PERF
+        (*ppList)->pNodeTail = NULL;
+#endif
         return true;
     }
 
@@ -27,6 +30,10 @@ static inline bool xlListWipe(tXL_LIST* pList) {
     pNode = pList->pNodeHead;
     while (pNode != NULL) {
         pNodeNext = NODE_NEXT(pNode);
+#ifdef SIM_PERF
+        NODE_TAG(pNode) = 0;
+        pNode = &NODE_PREVIOUS(pNode);
+#endif
         if (!xlHeapFree(&pNode)) {
             return false;
         }
@@ -36,6 +43,9 @@ static inline bool xlListWipe(tXL_LIST* pList) {
     pList->nItemCount = 0;
     pList->pNodeNext = NULL;
     pList->pNodeHead = NULL;
+#ifdef SIM_PERF
+    pList->pNodeTail = NULL;
+#endif
     return true;
 }
 
@@ -51,6 +61,71 @@ bool xlListFree(tXL_LIST** ppList) {
     return true;
 }
 
+#ifdef SIM_PERF
+bool xlListMakeItem(tXL_LIST* pList, void** ppItem) {
+    s32 nSize;
+    void* pListNode;
+
+    nSize = pList->nItemSize + 12;
+    if (!xlHeapTake(&pListNode, nSize)) {
+        return false;
+    }
+    pListNode = (u8*)pListNode + 8;
+
+    NODE_NEXT(pListNode) = NULL;
+    NODE_PREVIOUS(pListNode) = pList->pNodeTail;
+    NODE_TAG(pListNode) = NODE_TAG_LIST(pList);
+    *ppItem = NODE_DATA(pListNode);
+
+    if (pList->pNodeTail == NULL) {
+        pList->pNodeHead = pListNode;
+    } else {
+        NODE_NEXT(pList->pNodeTail) = pListNode;
+    }
+    pList->pNodeTail = pListNode;
+
+    pList->nItemCount++;
+    return true;
+}
+
+bool xlListFreeItem(tXL_LIST* pList, void** ppItem) {
+    void* pNode;
+    void* pNodeNext;
+    void* pNodePrevious;
+
+    if (pList->pNodeHead == NULL || *ppItem == NULL) {
+        return false;
+    }
+
+    pNode = NODE_FROM_DATA(*ppItem);
+    if (NODE_TAG(pNode) != NODE_TAG_LIST(pList)) {
+        return false;
+    }
+
+    pNodeNext = NODE_NEXT(pNode);
+    pNodePrevious = NODE_PREVIOUS(pNode);
+    if (pNodePrevious == NULL) {
+        pList->pNodeHead = pNodeNext;
+    } else {
+        NODE_NEXT(pNodePrevious) = pNodeNext;
+    }
+    if (pNodeNext == NULL) {
+        pList->pNodeTail = pNodePrevious;
+    } else {
+        NODE_PREVIOUS(pNodeNext) = pNodePrevious;
+    }
+
+    NODE_TAG(pNode) = 0;
+    *ppItem = NULL;
+    pNode = &NODE_PREVIOUS(pNode);
+    if (!xlHeapFree(&pNode)) {
+        return false;
+    }
+
+    pList->nItemCount--;
+    return true;
+}
+#else
 bool xlListMakeItem(tXL_LIST* pList, void** ppItem) {
     s32 nSize;
     void* pListNode;
@@ -104,7 +179,33 @@ bool xlListFreeItem(tXL_LIST* pList, void** ppItem) {
     NO_INLINE();
     return false;
 }
+#endif
+
+#ifdef SIM_PERF
+static inline bool xlListTest(tXL_LIST* pList) {
+    if (pList == &gListList) {
+        return true;
+    }
+
+    if (pList != NULL && NODE_TAG(NODE_FROM_DATA(pList)) == NODE_TAG_LIST(&gListList)) {
+        return true;
+    }
 
+    return false;
+}
+
+bool xlListTestItem(tXL_LIST* pList, void* pItem) {
+    if (!xlListTest(pList) || pItem == NULL) {
+        return false;
+    }
+
+    if (NODE_TAG(NODE_FROM_DATA(pItem)) == NODE_TAG_LIST(pList)) {
+        return true;
+    }
+
+    return false;
+}
+#else
 static inline bool xlListTest(tXL_LIST* pList) {
     void* pNode;
 
@@ -140,12 +241,16 @@ bool xlListTestItem(tXL_LIST* pList, void* pItem) {
 
     return false;
 }
+#endif
 
 bool xlListSetup(void) {
     gListList.nItemCount = 0;
     gListList.nItemSize = sizeof(tXL_LIST);
     gListList.pNodeNext = NULL;
     gListList.pNodeHead = NULL;
+#ifdef SIM_PERF
+    gListList.pNodeTail = NULL;
+#endif
     return true;
 }
 
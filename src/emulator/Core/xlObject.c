@@ -93,6 +93,7 @@ bool xlObjectTest(void* pObject, _XL_OBJECTTYPE* pType) {
     return false;
 }
 
+#ifndef SIM_PERF
 static inline bool xlObjectFindType(void* pObject, _XL_OBJECTTYPE* pType) {
     if (pObject != NULL) {
         __anon_0x5062* pData = *(__anon_0x5062**)((u8*)pObject - 4);
@@ -105,15 +106,21 @@ static inline bool xlObjectFindType(void* pObject, _XL_OBJECTTYPE* pType) {
 
     return false;
 }
+#endif
 
 bool xlObjectEvent(void* pObject, s32 nEvent, void* pArgument) {
     if (pObject != NULL) {
         __anon_0x5062* pData = *(__anon_0x5062**)((u8*)pObject - 4);
 
         if (xlListTestItem(gpListData, pData)) {
+#ifdef SIM_PERF
+            // `xlObjectFindType` would only repeat the test above
+            return pData->pType->pfEvent(pObject, nEvent, pArgument);
+#else
             if (xlObjectFindType(pObject, pData->pType)) {
                 return pData->pType->pfEvent(pObject, nEvent, pArgument);
             }
+#endif
         }
     }
 
@@ -134,7 +141,11 @@ bool xlObjectReset(void) {
     pListNode = gpListData->pNodeHead;
 
     while (pListNode != NULL) {
+#ifdef SIM_PERF
+        if (!xlListFree((tXL_LIST**)NODE_DATA(pListNode))) {
+#else
         if (!xlListFree((void*)((u8*)pListNode + 4))) {
+#endif
             return false;
         }
         pListNode = NODE_NEXT(pListNode);
@@ -42,7 +42,11 @@ bool audioPut32(Audio* pAudio, u32 nAddress, s32* pData) {
             pAudio->nControl = *pData & 1;
             break;
         case 0xC:
+#ifdef SIM_PERF
+            systemClearInterrupt(pAudio->pHost, SIT_AI);
+#else
             xlObjectEvent(pAudio->pHost, 0x1001, (void*)7);
+#endif
             break;
         case 0x10:
             pAudio->nRateDAC = *pData & 0x3FFF;
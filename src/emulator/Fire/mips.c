@@ -111,7 +111,11 @@ bool mipsPut32(Mips* pMips, u32 nAddress, s32* pData) {
                 pMips->nMode |= 0x100;
             }
             if (nData & 0x800) {
+#ifdef SIM_PERF
+                systemClearInterrupt(pMips->pHost, SIT_DP);
+#else
                 xlObjectEvent(pMips->pHost, 0x1001, (void*)0xA);
+#endif
             }
             if (nData & 0x1000) {
                 pMips->nMode &= ~0x200;
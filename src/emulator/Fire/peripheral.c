@@ -16,7 +16,11 @@ bool peripheralDMA_Complete(void) {
     Peripheral* pPeripheral = SYSTEM_PERIPHERAL(gpSystem);
 
     pPeripheral->nStatus &= 0xFFFFFFFC;
+#ifdef SIM_PERF
+    systemRaiseInterrupt(pPeripheral->pHost, SIT_PI);
+#else
     xlObjectEvent(pPeripheral->pHost, 0x1000, (void*)9);
+#endif
     return true;
 }
 
@@ -58,7 +62,11 @@ bool peripheralPut32(Peripheral* pPeripheral, u32 nAddress, s32* pData) {
                     }
                 }
             }
+#ifdef SIM_PERF
+            systemRaiseInterrupt(pPeripheral->pHost, SIT_PI);
+#else
             xlObjectEvent(pPeripheral->pHost, 0x1000, (void*)9);
+#endif
             break;
         case 0x0C:
             pPeripheral->nSizePut = *pData & 0xFFFFFF;
@@ -90,12 +98,20 @@ bool peripheralPut32(Peripheral* pPeripheral, u32 nAddress, s32* pData) {
                 }
             }
             if (bFlag) {
+#ifdef SIM_PERF
+                systemRaiseInterrupt(pPeripheral->pHost, SIT_PI);
+#else
                 xlObjectEvent(pPeripheral->pHost, 0x1000, (void*)9);
+#endif
             }
             break;
         case 0x10:
             if (*pData & 2) {
+#ifdef SIM_PERF
+                systemClearInterrupt(pPeripheral->pHost, SIT_PI);
+#else
                 xlObjectEvent(pPeripheral->pHost, 0x1001, (void*)9);
+#endif
             }
             break;
         case 0x14:
@@ -84,7 +84,11 @@ static bool rdbPut32(Rdb* pRDB, u32 nAddress, s32* pData) {
                         default:
                             return false;
                     }
+#ifdef SIM_PERF
+                    systemRaiseInterrupt(pRDB->pHost, SIT_RDB);
+#else
                     xlObjectEvent(pRDB->pHost, 0x1000, (void*)4);
+#endif
                     break;
                 case 2:
                     return false;
@@ -135,7 +139,11 @@ static bool rdbPut32(Rdb* pRDB, u32 nAddress, s32* pData) {
         case 0x8:
             break;
         case 0xC:
+#ifdef SIM_PERF
+            systemClearInterrupt(pRDB->pHost, SIT_RDB);
+#else
             xlObjectEvent(pRDB->pHost, 0x1001, (void*)4);
+#endif
             break;
         default:
             return false;
@@ -6,6 +6,9 @@
 #include "emulator/simGCN.h"
 #include "emulator/system.h"
 #include "emulator/xlCoreGCN.h"
+#ifdef SIM_PERF
+#include "emulator/xlHeap.h"
+#endif
 #include "macros.h"
 
 _XL_OBJECTTYPE gClassRDP = {
@@ -15,6 +18,40 @@ _XL_OBJECTTYPE gClassRDP = {
     (EventFunc)rdpEvent,
 };
 
+#ifdef SIM_PERF
+static inline void rdpCountCommand(Rdp* pRDP, u32 nOpcode) {
+    RdpStats* pStats = &pRDP->aStats[pRDP->iStats];
+
+    pRDP->anCountOpcode[nOpcode & 0x3F]++;
+    pStats->nCountCommand++;
+    switch (nOpcode) {
+        case 0xF4: // G_LOADTILE
+        case 0xF3: // G_LOADBLOCK
+            pStats->nCountLoadTexture++;
+            break;
+        case 0xF0: // G_LOADTLUT
+            pStats->nCountLoadTLUT++;
+            break;
+        case 0xFD: // G_SETTIMG
+            pStats->nCountSetTexture++;
+            break;
+        case 0xFC: // G_SETCOMBINE
+            pStats->nCountSetCombine++;
+            break;
+        case 0xF6: // G_FILLRECT
+        case 0xE5: // G_TEXRECTFLIP
+        case 0xE4: // G_TEXRECT
+            pStats->nCountRectangle++;
+            break;
+        default:
+            if ((nOpcode & 0xF8) == 0xC8) {
+                pStats->nCountTriangle++;
+            }
+            break;
+    }
+}
+#endif
+
 bool rdpParseGBI(Rdp* pRDP, u64** ppnGBI, RspUCodeType eTypeUCode) {
     u32 nA;
     u32 nB;
@@ -24,11 +61,20 @@ bool rdpParseGBI(Rdp* pRDP, u64** ppnGBI, RspUCodeType eTypeUCode) {
     u32 nCommandLo;
     u32 nCommandHi;
     Frame* pFrame;
+#ifdef SIM_PERF
+    OSTick nTick;
+#endif
 
     pnGBI = *ppnGBI;
     pFrame = SYSTEM_FRAME(pRDP->pHost);
     nCommandHi = GBI_COMMAND_HI(pnGBI);
     nCommandLo = GBI_COMMAND_LO(pnGBI);
+#ifdef SIM_PERF
+    if (SIM_PERF_STATS > 0) {
+        nTick = OSGetTick();
+        rdpCountCommand(pRDP, nCommandHi >> 24);
+    }
+#endif
 
     *ppnGBI = ++pnGBI;
     pFrame->pnGBI = pnGBI;
@@ -582,8 +628,52 @@ bool rdpParseGBI(Rdp* pRDP, u64** ppnGBI, RspUCodeType eTypeUCode) {
             return false;
     }
 
+#ifdef SIM_PERF
+    if (SIM_PERF_STATS > 0) {
+        pRDP->aStats[pRDP->iStats].nTickParse += OSGetTick() - nTick;
+    }
+#endif
+    return true;
+}
+
+#ifdef SIM_PERF
+// Closes the frame in progress, called once per frame (see `systemUpdateStats`)
+bool rdpUpdateStats(Rdp* pRDP) {
+    pRDP->nFrame++;
+    pRDP->iStats = (pRDP->iStats + 1) % RDP_STATS_COUNT;
+    if (pRDP->nCountStats < RDP_STATS_COUNT) {
+        pRDP->nCountStats++;
+    }
+
+    return xlHeapFill32(&pRDP->aStats[pRDP->iStats], sizeof(RdpStats), 0);
+}
+
+// Prints the frames closed since the last dump, oldest first, then the command counts by opcode
+bool rdpDumpStats(Rdp* pRDP) {
+    RdpStats* pStats;
+    s32 iStats;
+    s32 iOpcode;
+
+    for (iStats = pRDP->nCountStats; iStats > 0; iStats--) {
+        pStats = &pRDP->aStats[(pRDP->iStats + RDP_STATS_COUNT - iStats) % RDP_STATS_COUNT];
+        OSReport("RDPSTAT frame %u: %u cmds, %u tex loads, %u tlut loads, %u settimg, %u combines, %u rects, %u tris, "
+                 "%u us\n",
+                 pRDP->nFrame - iStats, pStats->nCountCommand, pStats->nCountLoadTexture, pStats->nCountLoadTLUT,
+                 pStats->nCountSetTexture, pStats->nCountSetCombine, pStats->nCountRectangle, pStats->nCountTriangle,
+                 OSTicksToMicroseconds(pStats->nTickParse));
+    }
+
+    for (iOpcode = 0; iOpcode < ARRAY_COUNT(pRDP->anCountOpcode); iOpcode++) {
+        if (pRDP->anCountOpcode[iOpcode] != 0) {
+            OSReport("RDPGBI 0x%02X: %u\n", 0xC0 + iOpcode, pRDP->anCountOpcode[iOpcode]);
+            pRDP->anCountOpcode[iOpcode] = 0;
+        }
+    }
+
+    pRDP->nCountStats = 0;
     return true;
 }
+#endif
 
 static bool rdpPut8(Rdp* pRDP, u32 nAddress, s32* pData) { return false; }
 
@@ -598,7 +688,11 @@ static bool rdpPut32(Rdp* pRDP, u32 nAddress, s32* pData) {
             break;
         case 0x04:
             pRDP->nAddress1 = *pData & 0xFFFFFF;
+#ifdef SIM_PERF
+            systemRaiseInterrupt(pRDP->pHost, SIT_DP);
+#else
             xlObjectEvent(pRDP->pHost, 0x1000, (void*)10);
+#endif
             break;
         case 0x08:
             break;
@@ -738,6 +832,13 @@ bool rdpEvent(Rdp* pRDP, s32 nEvent, void* pArgument) {
         case 2:
             pRDP->pHost = pArgument;
             pRDP->nStatus = 0;
+#ifdef SIM_PERF
+            pRDP->nFrame = 0;
+            pRDP->iStats = 0;
+            pRDP->nCountStats = 0;
+            xlHeapFill32(pRDP->anCountOpcode, sizeof(pRDP->anCountOpcode), 0);
+            xlHeapFill32(pRDP->aStats, sizeof(pRDP->aStats), 0);
+#endif
             break;
         case 0x1002:
             switch (((CpuDevice*)pArgument)->nType) {
@@ -373,7 +373,11 @@ static bool romFindOldestBlock(Rom* pROM, s32* piBlock, RomCacheType eTypeCache,
 
     for (iBlock = 0; iBlock < ARRAY_COUNT(pROM->aBlock); iBlock++) {
         pBlock = &pROM->aBlock[iBlock];
+#ifdef SIM_PERF
+        if (pBlock->nSize != 0 && !pBlock->bTransfer &&
+#else
         if (pBlock->nSize != 0 &&
+#endif
             ((eTypeCache == RCT_RAM && pBlock->iCache >= 0) || (eTypeCache == RCT_ARAM && pBlock->iCache < 0))) {
             if (pBlock->nTickUsed > nTick) {
                 nTickDelta = -1 - (pBlock->nTickUsed - nTick);
@@ -420,6 +424,19 @@ static inline void romMarkBlockAsFree(Rom* pROM, s32 iBlock) {
     pBlock->nSize = 0;
 }
 
+#ifdef SIM_PERF
+static inline void romTraceBlock(Rom* pROM, u32 iBlock) {
+    RomTraceBlock* pTraceBlock;
+
+    if (pROM->pTrace != NULL) {
+        pTraceBlock = &pROM->pTrace->aBlock[iBlock];
+        if (pTraceBlock->nCount++ == 0) {
+            pTraceBlock->nTimeFirst = OSTicksToMilliseconds(OSGetTick() - pROM->pTrace->nTickStart);
+        }
+    }
+}
+#endif
+
 static bool romMakeFreeCache(Rom* pROM, s32* piCache, RomCacheType eType) {
     s32 iCache;
     s32 iBlockOldest;
@@ -452,6 +469,310 @@ static bool romMakeFreeCache(Rom* pROM, s32* piCache, RomCacheType eType) {
     return true;
 }
 
+#ifdef SIM_PERF
+// Converts `nSize` bytes (rounded up to a whole word) of ROM data in `eOrder` to big-endian in place.
+// Both orders are handled with one byte-reversed load per word: a 32-bit swap is the reversed word itself,
+// and a 16-bit swap is the reversed word rotated by 16.
+static void romSwapBuffer(void* pBuffer, u32 nSize, RomByteOrder eOrder) {
+    u32* anData;
+    u32 nCount;
+    u32 nData0;
+    u32 nData1;
+    u32 nData2;
+    u32 nData3;
+
+    if (eOrder == RBO_NONE) {
+        return;
+    }
+
+    anData = (u32*)pBuffer;
+    nCount = (nSize + 3) >> 2;
+
+#ifdef __MWERKS__
+    if (eOrder == RBO_SWAP16) {
+        for (; nCount >= 4; nCount -= 4, anData += 4) {
+            nData0 = __lwbrx(anData, 0);
+            nData1 = __lwbrx(anData, 4);
+            nData2 = __lwbrx(anData, 8);
+            nData3 = __lwbrx(anData, 12);
+            anData[0] = __rlwinm(nData0, 16, 0, 31);
+            anData[1] = __rlwinm(nData1, 16, 0, 31);
+            anData[2] = __rlwinm(nData2, 16, 0, 31);
+            anData[3] = __rlwinm(nData3, 16, 0, 31);
+        }
+        for (; nCount != 0; nCount--, anData++) {
+            nData0 = __lwbrx(anData, 0);
+            *anData = __rlwinm(nData0, 16, 0, 31);
+        }
+    } else {
+        for (; nCount >= 4; nCount -= 4, anData += 4) {
+            nData0 = __lwbrx(anData, 0);
+            nData1 = __lwbrx(anData, 4);
+            nData2 = __lwbrx(anData, 8);
+            nData3 = __lwbrx(anData, 12);
+            anData[0] = nData0;
+            anData[1] = nData1;
+            anData[2] = nData2;
+            anData[3] = nData3;
+        }
+        for (; nCount != 0; nCount--, anData++) {
+            *anData = __lwbrx(anData, 0);
+        }
+    }
+#else
+    if (eOrder == RBO_SWAP16) {
+        for (; nCount >= 4; nCount -= 4, anData += 4) {
+            nData0 = anData[0];
+            nData1 = anData[1];
+            nData2 = anData[2];
+            nData3 = anData[3];
+            anData[0] = ((nData0 >> 8) & 0x00FF00FF) | ((nData0 << 8) & 0xFF00FF00);
+            anData[1] = ((nData1 >> 8) & 0x00FF00FF) | ((nData1 << 8) & 0xFF00FF00);
+            anData[2] = ((nData2 >> 8) & 0x00FF00FF) | ((nData2 << 8) & 0xFF00FF00);
+            anData[3] = ((nData3 >> 8) & 0x00FF00FF) | ((nData3 << 8) & 0xFF00FF00);
+        }
+        for (; nCount != 0; nCount--, anData++) {
+            nData0 = *anData;
+            *anData = ((nData0 >> 8) & 0x00FF00FF) | ((nData0 << 8) & 0xFF00FF00);
+        }
+    } else {
+        for (; nCount != 0; nCount--, anData++) {
+            nData0 = *anData;
+            *anData = (nData0 >> 24) | ((nData0 >> 8) & 0xFF00) | ((nData0 << 8) & 0xFF0000) | (nData0 << 24);
+        }
+    }
+#endif
+}
+
+static void romTransferStart(Rom* pROM) {
+    RomTransfer* pTransfer;
+    s32 nOffsetRAM;
+    s32 nOffsetARAM;
+
+    pTransfer = &pROM->transfer.aTransfer[pROM->transfer.iHead];
+    nOffsetRAM = pTransfer->iCacheRAM * 0x2000;
+    nOffsetARAM = pTransfer->iCacheARAM * 0x2000;
+    nOffsetARAM += ARGetBaseAddress();
+
+    while (ARGetDMAStatus()) {}
+
+    if (pTransfer->eType == RCT_RAM) {
+        ARStartDMARead((u32)&pROM->pCacheRAM[nOffsetRAM], nOffsetARAM, 0x2000);
+        DCInvalidateRange(&pROM->pCacheRAM[nOffsetRAM], 0x2000);
+    } else {
+        DCStoreRange(&pROM->pCacheRAM[nOffsetRAM], 0x2000);
+        ARStartDMAWrite((u32)&pROM->pCacheRAM[nOffsetRAM], nOffsetARAM, 0x2000);
+    }
+
+    pROM->transfer.bActive = true;
+}
+
+static bool romTransferComplete(Rom* pROM) {
+    RomTransfer* pTransfer;
+    RomBlock* pBlock;
+    UnknownCallbackFunc* pCallback;
+    s32 iCacheRAM;
+    s32 iCacheARAM;
+
+    pTransfer = &pROM->transfer.aTransfer[pROM->transfer.iHead];
+    pBlock = &pROM->aBlock[pTransfer->iBlock];
+    iCacheRAM = pTransfer->iCacheRAM;
+    iCacheARAM = pTransfer->iCacheARAM;
+    pCallback = pTransfer->pCallback;
+
+    pROM->transfer.bActive = false;
+    pROM->transfer.iHead = (pROM->transfer.iHead + 1) % ARRAY_COUNT(pROM->transfer.aTransfer);
+    pROM->transfer.nCount--;
+
+    if (pTransfer->eType == RCT_RAM) {
+        pROM->anBlockCachedARAM[iCacheARAM >> 3] &= ~(1 << (iCacheARAM & 7));
+        pBlock->iCache = iCacheRAM;
+    } else if (pBlock->nTickUsed != pTransfer->nTickUsed) {
+        // The block was used while it was being written out, so keep it in RAM and drop the ARAM copy
+        pROM->anBlockCachedARAM[iCacheARAM >> 3] &= ~(1 << (iCacheARAM & 7));
+    } else {
+        pROM->anBlockCachedRAM[iCacheRAM >> 3] &= ~(1 << (iCacheRAM & 7));
+        pBlock->iCache = -(iCacheARAM + 1);
+    }
+    pBlock->bTransfer = false;
+
+    if (pCallback != NULL && !pCallback()) {
+        return false;
+    }
+
+    return true;
+}
+
+// Starts queued transfers and completes finished ones without waiting on the DMA hardware
+static bool romTransferUpdate(Rom* pROM) {
+    while (pROM->transfer.nCount != 0) {
+        if (!pROM->transfer.bActive) {
+            romTransferStart(pROM);
+        }
+        if (ARGetDMAStatus()) {
+            break;
+        }
+        if (!romTransferComplete(pROM)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Waits until `iBlock` has no transfer queued, or until the queue is empty if `iBlock` is -1
+static bool romTransferWait(Rom* pROM, s32 iBlock) {
+    while (pROM->transfer.nCount != 0 && (iBlock < 0 || pROM->aBlock[iBlock].bTransfer)) {
+        if (!pROM->transfer.bActive) {
+            romTransferStart(pROM);
+        }
+
+        while (ARGetDMAStatus()) {}
+
+        if (!romTransferComplete(pROM)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Queues a move of `iBlock` between RAM and ARAM. The block stays readable from its current cache until the
+// transfer completes; the destination slot is reserved in the meantime.
+static bool romTransferPost(Rom* pROM, s32 iBlock, RomCacheType eType, UnknownCallbackFunc* pCallback) {
+    RomTransfer* pTransfer;
+    RomBlock* pBlock;
+    s32 iCacheRAM;
+    s32 iCacheARAM;
+
+    if (pROM->transfer.nCount == ARRAY_COUNT(pROM->transfer.aTransfer)) {
+        if (!romTransferWait(pROM, pROM->transfer.aTransfer[pROM->transfer.iHead].iBlock)) {
+            return false;
+        }
+    }
+
+    pBlock = &pROM->aBlock[iBlock];
+    if (eType == RCT_RAM) {
+        iCacheARAM = -(pBlock->iCache + 1);
+        if (!romMakeFreeCache(pROM, &iCacheRAM, RCT_RAM)) {
+            return false;
+        }
+        pROM->anBlockCachedRAM[iCacheRAM >> 3] |= (1 << (iCacheRAM & 7));
+    } else if (eType == RCT_ARAM) {
+        iCacheRAM = pBlock->iCache;
+        if (!romMakeFreeCache(pROM, &iCacheARAM, RCT_ARAM)) {
+            return false;
+        }
+        iCacheARAM = -(iCacheARAM + 1);
+        pROM->anBlockCachedARAM[iCacheARAM >> 3] |= (1 << (iCacheARAM & 7));
+    } else {
+        return false;
+    }
+
+    // `romMakeFreeCache` may have waited on the queue, so look up the tail only now
+    pTransfer = &pROM->transfer.aTransfer[(pROM->transfer.iHead + pROM->transfer.nCount) %
+                                          ARRAY_COUNT(pROM->transfer.aTransfer)];
+    pTransfer->iBlock = iBlock;
+    pTransfer->iCacheRAM = iCacheRAM;
+    pTransfer->iCacheARAM = iCacheARAM;
+    pTransfer->eType = eType;
+    pTransfer->nTickUsed = pBlock->nTickUsed;
+    pTransfer->pCallback = pCallback;
+    pROM->transfer.nCount++;
+    pBlock->bTransfer = true;
+
+    if (pROM->transfer.nCount == 1) {
+        romTransferStart(pROM);
+    }
+
+    return true;
+}
+
+static bool romSetBlockCache(Rom* pROM, s32 iBlock, RomCacheType eType) {
+    RomBlock* pBlock;
+
+    pBlock = &pROM->aBlock[iBlock];
+    if (pBlock->bTransfer && !romTransferWait(pROM, iBlock)) {
+        return false;
+    }
+
+    if ((eType == RCT_RAM && pBlock->iCache >= 0) || (eType == RCT_ARAM && pBlock->iCache < 0)) {
+        return true;
+    }
+
+    if (!romTransferPost(pROM, iBlock, eType, NULL)) {
+        return false;
+    }
+
+    if (!romTransferWait(pROM, iBlock)) {
+        return false;
+    }
+
+    return true;
+}
+
+// Keeps one RAM cache slot free by writing the oldest RAM block out to ARAM in the background
+static bool romTransferDemoteOldest(Rom* pROM) {
+    s32 iCache;
+    s32 iBlock;
+    s32 iBlockARAM;
+
+    if (pROM->eModeLoad != RLM_PART || pROM->transfer.nCount != 0) {
+        return true;
+    }
+
+    if (romFindFreeCache(pROM, &iCache, RCT_RAM) || !romFindOldestBlock(pROM, &iBlock, RCT_RAM, 2)) {
+        return true;
+    }
+
+    if (!romFindFreeCache(pROM, &iCache, RCT_ARAM) && !romFindOldestBlock(pROM, &iBlockARAM, RCT_ARAM, 0)) {
+        return true;
+    }
+
+    return romTransferPost(pROM, iBlock, RCT_ARAM, NULL);
+}
+
+static bool __romLoadBlock_Complete(Rom* pROM) {
+    s32 iBlock;
+    s32 iCache;
+    s32 iExtent;
+    u32 nSize;
+    u32 nSizeBlock;
+
+    romSwapBuffer(pROM->load.anData, pROM->load.nSize, pROM->eByteOrder);
+
+    nSize = pROM->load.nSize;
+    for (iExtent = 0; iExtent < pROM->load.nCountBlock; iExtent++) {
+        iBlock = pROM->load.iBlock + iExtent;
+        iCache = pROM->load.aiCache[iExtent];
+        if ((nSizeBlock = nSize) > 0x2000) {
+            nSizeBlock = 0x2000;
+        }
+
+        if (pROM->load.nCountBlock > 1 &&
+            !xlHeapCopy(&pROM->pCacheRAM[iCache * 0x2000], pROM->load.anData + iExtent * 0x2000, nSizeBlock)) {
+            return false;
+        }
+
+        pROM->aBlock[iBlock].nSize = nSizeBlock;
+        pROM->aBlock[iBlock].iCache = iCache;
+        pROM->aBlock[iBlock].keep = 0;
+        pROM->aBlock[iBlock].bTransfer = false;
+        if (iExtent != 0) {
+            pROM->aBlock[iBlock].nTickUsed = pROM->nTick;
+        }
+
+        pROM->anBlockCachedRAM[iCache >> 3] |= (1 << (iCache & 7));
+        nSize -= nSizeBlock;
+    }
+
+    if ((pROM->load.pCallback != NULL) && !pROM->load.pCallback()) {
+        return false;
+    }
+
+    return true;
+}
+#else
 static bool romSetBlockCache(Rom* pROM, s32 iBlock, RomCacheType eType) {
     RomBlock* pBlock;
     s32 iCacheRAM;
@@ -537,6 +858,7 @@ static bool __romLoadBlock_Complete(Rom* pROM) {
 
     return true;
 }
+#endif
 
 static void __romLoadBlock_CompleteGCN(long nResult, DVDFileInfo* fileInfo) {
     Rom* pROM = SYSTEM_ROM(gpSystem);
@@ -545,6 +867,100 @@ static void __romLoadBlock_CompleteGCN(long nResult, DVDFileInfo* fileInfo) {
     pROM->load.bDone = true;
 }
 
+#ifdef SIM_PERF
+static s32 romGetExtentCount(Rom* pROM, s32 iBlock) {
+    s32 iExtent;
+    u32 nOffset;
+
+    nOffset = iBlock * 0x2000;
+    for (iExtent = 0; iExtent < pROM->nCountExtent; iExtent++) {
+        if (pROM->aExtent[iExtent].nOffset0 <= nOffset && nOffset <= pROM->aExtent[iExtent].nOffset1) {
+            return pROM->aExtent[iExtent].nCountBlock;
+        }
+    }
+
+    return pROM->nCountBlockExtent;
+}
+
+// Loads up to `nCountBlock` consecutive uncached blocks starting at `iBlock` with a single DVD read. Extents of
+// more than one block are read into `pExtentBuffer` and then copied into a free RAM cache slot per block.
+static bool romLoadBlock(Rom* pROM, s32 iBlock, s32 nCountBlock, UnknownCallbackFunc pCallback) {
+    u8* anData;
+    s32 nSizeRead;
+    s32 iCache;
+    s32 iExtent;
+    u32 nSize;
+    u32 nOffset;
+
+    nOffset = iBlock * 0x2000;
+    if (nCountBlock > ROM_EXTENT_BLOCKS_MAX) {
+        nCountBlock = ROM_EXTENT_BLOCKS_MAX;
+    }
+    for (iExtent = 1; iExtent < nCountBlock; iExtent++) {
+        if (nOffset + iExtent * 0x2000 >= pROM->nSize || pROM->aBlock[iBlock + iExtent].nSize != 0) {
+            break;
+        }
+    }
+    nCountBlock = iExtent;
+
+    if (nCountBlock > 1 && pROM->pExtentBuffer == NULL &&
+        !xlHeapTake((void**)&pROM->pExtentBuffer, (ROM_EXTENT_BLOCKS_MAX * 0x2000) | 0x30000000)) {
+        nCountBlock = 1;
+    }
+
+    // Reserve every cache slot now, so that later slots don't reuse earlier ones
+    for (iExtent = 0; iExtent < nCountBlock; iExtent++) {
+        if (!romMakeFreeCache(pROM, &iCache, RCT_RAM)) {
+            if (iExtent == 0) {
+                return false;
+            }
+            break;
+        }
+        pROM->anBlockCachedRAM[iCache >> 3] |= (1 << (iCache & 7));
+        pROM->load.aiCache[iExtent] = iCache;
+    }
+    nCountBlock = iExtent;
+
+    if ((nSize = pROM->nSize - nOffset) > nCountBlock * 0x2000) {
+        nSize = nCountBlock * 0x2000;
+    }
+    if (nCountBlock == 1) {
+        anData = &pROM->pCacheRAM[pROM->load.aiCache[0] * 0x2000];
+    } else {
+        anData = pROM->pExtentBuffer;
+    }
+    nSizeRead = (nSize + 0x1F) & 0xFFFFFFE0;
+
+    pROM->load.nSize = nSize;
+    pROM->load.iBlock = iBlock;
+    pROM->load.iCache = pROM->load.aiCache[0];
+    pROM->load.nCountBlock = nCountBlock;
+    pROM->load.anData = anData;
+    pROM->load.pCallback = pCallback;
+
+    pROM->stats.nCountRead++;
+    pROM->stats.nSizeRead += nSizeRead;
+
+    if (pCallback == NULL) {
+        if (!simulatorDVDRead(&pROM->fileInfo, anData, nSizeRead, nOffset + pROM->offsetToRom, NULL)) {
+            return false;
+        }
+    } else {
+        pROM->load.nOffset = nOffset;
+        pROM->load.nSizeRead = nSizeRead;
+        if (!simulatorDVDRead(&pROM->fileInfo, anData, nSizeRead, nOffset + pROM->offsetToRom,
+                              &__romLoadBlock_CompleteGCN)) {
+            return false;
+        }
+        return true;
+    }
+
+    if (!__romLoadBlock_Complete(pROM)) {
+        return false;
+    }
+    return true;
+}
+#else
 static bool romLoadBlock(Rom* pROM, s32 iBlock, s32 iCache, UnknownCallbackFunc pCallback) {
     u8* anData;
     s32 nSizeRead;
@@ -583,10 +999,13 @@ static bool romLoadBlock(Rom* pROM, s32 iBlock, s32 iCache, UnknownCallbackFunc
     }
     return true;
 }
+#endif
 
 static bool romLoadRange(Rom* pROM, s32 begin, s32 end, s32* blockCount, s32 whichBlock,
                          ProgressCallbackFunc* pProgressCallback) {
+#ifndef SIM_PERF
     s32 iCache;
+#endif
     u32 iBlock;
     u32 iBlockLast;
 
@@ -596,6 +1015,12 @@ static bool romLoadRange(Rom* pROM, s32 begin, s32 end, s32* blockCount, s32 whi
             pProgressCallback((f32)(iBlock - (begin / 0x2000)) / (f32)((end - begin) / 0x2000));
         }
 
+#ifdef SIM_PERF
+        if (pROM->aBlock[iBlock].nSize == 0 &&
+            !romLoadBlock(pROM, iBlock, iBlockLast - iBlock + 1, NULL)) {
+            return false;
+        }
+#else
         if (pROM->aBlock[iBlock].nSize == 0) {
             if (!romMakeFreeCache(pROM, &iCache, RCT_RAM)) {
                 return false;
@@ -605,6 +1030,7 @@ static bool romLoadRange(Rom* pROM, s32 begin, s32 end, s32* blockCount, s32 whi
                 return false;
             }
         }
+#endif
 
         pROM->aBlock[iBlock].keep = whichBlock;
         pROM->aBlock[iBlock].nTickUsed = ++pROM->nTick;
@@ -617,6 +1043,28 @@ static bool romLoadRange(Rom* pROM, s32 begin, s32 end, s32* blockCount, s32 whi
     return true;
 }
 
+#ifdef SIM_PERF
+static bool romLoadPinSet(Rom* pROM, s32* blockCount, ProgressCallbackFunc* pProgressCallback) {
+    s32 iRange;
+    u32 nOffset1;
+
+    for (iRange = 0; iRange < pROM->nCountPinRange; iRange += 2) {
+        if (pROM->anPinRange[iRange] >= pROM->nSize) {
+            continue;
+        }
+        if ((nOffset1 = pROM->anPinRange[iRange + 1]) >= pROM->nSize) {
+            nOffset1 = pROM->nSize - 1;
+        }
+
+        if (!romLoadRange(pROM, pROM->anPinRange[iRange], nOffset1, blockCount, 1, pProgressCallback)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+#endif
+
 static bool romCacheGame_ZELDA(f32 rProgress) {
     s32 nSize;
     Mtx44 matrix44;
@@ -784,7 +1232,15 @@ bool romCacheGame(Rom* pROM) {
             gbProgress = false;
             gbDisplayedError = true;
         }
+#ifdef SIM_PERF
+        if (pROM->nCountPinRange != 0) {
+            if (!romLoadPinSet(pROM, &blockCount, &romCacheGame_ZELDA)) {
+                return false;
+            }
+        } else if (gnFlagZelda & 2) {
+#else
         if (gnFlagZelda & 2) {
+#endif
             if (!romLoadRange(pROM, 0, 0xA6251F, &blockCount, 1, &romCacheGame_ZELDA)) {
                 return false;
             }
@@ -799,6 +1255,12 @@ bool romCacheGame(Rom* pROM) {
                 return false;
             }
         }
+#ifdef SIM_PERF
+    } else if (pROM->nCountPinRange != 0) {
+        if (!romLoadPinSet(pROM, &blockCount, NULL)) {
+            return false;
+        }
+#endif
     } else if (romTestCode(pROM, "NZSJ") || romTestCode(pROM, "NZSE")) {
         if (!romLoadRange(pROM, 0, 0xEFAB5F, &blockCount, 1, NULL)) {
             return false;
@@ -878,7 +1340,15 @@ static bool romCacheGame(Rom* pROM) {
             gbProgress = false;
             gbDisplayedError = true;
         }
+#ifdef SIM_PERF
+        if (pROM->nCountPinRange != 0) {
+            if (!romLoadPinSet(pROM, &blockCount, &romCacheGame_ZELDA)) {
+                return false;
+            }
+        } else if (gnFlagZelda & 2) {
+#else
         if (gnFlagZelda & 2) {
+#endif
             if (!romLoadRange(pROM, 0, 0xA6251F, &blockCount, 1, &romCacheGame_ZELDA)) {
                 return false;
             }
@@ -893,6 +1363,12 @@ static bool romCacheGame(Rom* pROM) {
                 return false;
             }
         }
+#ifdef SIM_PERF
+    } else if (pROM->nCountPinRange != 0) {
+        if (!romLoadPinSet(pROM, &blockCount, NULL)) {
+            return false;
+        }
+#endif
     } else if (romTestCode(pROM, "NZSJ") || romTestCode(pROM, "NZSE")) {
         if (!romLoadRange(pROM, 0, 0xEFAB5F, &blockCount, 1, NULL)) {
             return false;
@@ -918,7 +1394,9 @@ bool __romLoadUpdate_Complete(void) {
 }
 
 static bool romLoadUpdate(Rom* pROM) {
+#ifndef SIM_PERF
     s32 iCache;
+#endif
     RomBlock* pBlock;
     u32 iBlock0;
     u32 iBlock1;
@@ -944,12 +1422,18 @@ static bool romLoadUpdate(Rom* pROM) {
         pBlock = &pROM->aBlock[iBlock0];
         pBlock->nTickUsed = ++pROM->nTick;
         if (pBlock->nSize == 0) {
+#ifndef SIM_PERF
             if (!romMakeFreeCache(pROM, &iCache, 0)) {
                 return false;
             }
+#endif
 
             pROM->load.bWait = true;
+#ifdef SIM_PERF
+            if (!romLoadBlock(pROM, iBlock0, iBlock1 - iBlock0 + 1, &__romLoadUpdate_Complete)) {
+#else
             if (!romLoadBlock(pROM, iBlock0, iCache, &__romLoadUpdate_Complete)) {
+#endif
                 return false;
             }
 
@@ -974,7 +1458,9 @@ static bool __romCopyUpdate_Complete(void) {
 static bool romCopyUpdate(Rom* pROM) {
     RomBlock* pBlock;
     s32 pad;
+#ifndef SIM_PERF
     s32 iCache;
+#endif
     s32 nTickLast;
     u8* anData;
     u32 iBlock;
@@ -1014,25 +1500,65 @@ static bool romCopyUpdate(Rom* pROM) {
         pBlock = &pROM->aBlock[iBlock];
         nTickLast = pBlock->nTickUsed;
         pBlock->nTickUsed = ++pROM->nTick;
+#ifdef SIM_PERF
+        romTraceBlock(pROM, iBlock);
+#endif
 
         if (pBlock->nSize != 0) {
+#ifdef SIM_PERF
+            if (iBlock != pROM->iBlockWait) {
+                pROM->stats.nCountHit++;
+            }
+            if (pBlock->iCache < 0) {
+                if (pROM->copy.pCallback == NULL) {
+                    if (!romSetBlockCache(pROM, iBlock, RCT_RAM)) {
+                        return false;
+                    }
+                } else {
+                    // Let the promotion run while emulation continues; `romUpdate` resumes the copy
+                    pROM->iBlockWait = iBlock;
+                    if (!pBlock->bTransfer) {
+                        pROM->copy.bWait = true;
+                        if (!romTransferPost(pROM, iBlock, RCT_RAM, &__romCopyUpdate_Complete)) {
+                            return false;
+                        }
+                    }
+                    return true;
+                }
+            }
+            pROM->iBlockWait = -1;
+#else
             if (pBlock->iCache < 0 && !romSetBlockCache(pROM, iBlock, 0)) {
                 return false;
             }
+#endif
         } else {
+#ifdef SIM_PERF
+            pROM->stats.nCountMiss++;
+#else
             if (!romMakeFreeCache(pROM, &iCache, 0)) {
                 return false;
             }
 
+#endif
             if (pROM->copy.pCallback == NULL) {
+#ifdef SIM_PERF
+                if (!romLoadBlock(pROM, iBlock, romGetExtentCount(pROM, iBlock), NULL)) {
+#else
                 if (!romLoadBlock(pROM, iBlock, iCache, NULL)) {
+#endif
                     return false;
                 }
             } else {
                 pBlock->nTickUsed = nTickLast;
                 pROM->nTick--;
                 pROM->copy.bWait = true;
+#ifdef SIM_PERF
+                pROM->iBlockWait = iBlock;
+                if (!romLoadBlock(pROM, iBlock, romGetExtentCount(pROM, iBlock), &__romCopyUpdate_Complete)) {
+#else
                 if (!romLoadBlock(pROM, iBlock, iCache, &__romCopyUpdate_Complete)) {
+#endif
                     return false;
                 } else {
                     return true;
@@ -1063,7 +1589,9 @@ static bool romCopyUpdate(Rom* pROM) {
 
 static inline bool romLoadFullOrPartLoop(Rom* pROM) {
     s32 i;
+#ifndef SIM_PERF
     s32 iCache;
+#endif
     u32 temp_r27;
     u32 temp_r30;
 
@@ -1073,11 +1601,15 @@ static inline bool romLoadFullOrPartLoop(Rom* pROM) {
     for (i = 0; i < temp_r30; i++) {
         pROM->aBlock[i].nTickUsed = temp_r27 - i;
 
+#ifdef SIM_PERF
+        if (pROM->aBlock[i].nSize == 0 && !romLoadBlock(pROM, i, temp_r30 - i, NULL)) {
+#else
         if (!romMakeFreeCache(pROM, &iCache, RCT_RAM)) {
             return false;
         }
 
         if (!romLoadBlock(pROM, i, iCache, NULL)) {
+#endif
             return false;
         }
     }
@@ -1099,6 +1631,9 @@ static bool romLoadFullOrPart(Rom* pROM) {
             pROM->aBlock[i].nSize = 0;
             pROM->aBlock[i].iCache = 0;
             pROM->aBlock[i].nTickUsed = 0;
+#ifdef SIM_PERF
+            pROM->aBlock[i].bTransfer = false;
+#endif
         }
 
         for (i = 0; i < ARRAY_COUNTU(pROM->anBlockCachedRAM); i++) {
@@ -1146,6 +1681,9 @@ static bool romLoadFullOrPart(Rom* pROM) {
         }
 
         pROM->eModeLoad = RLM_FULL;
+#ifdef SIM_PERF
+        romSwapBuffer(pROM->pBuffer, pROM->nSize, pROM->eByteOrder);
+#else
 
         if (pROM->bFlip) {
             //! TODO: this might be an inline function, see ``__romLoadBlock_Complete``
@@ -1156,6 +1694,7 @@ static bool romLoadFullOrPart(Rom* pROM) {
                 *pBuffer++ = ((*pBuffer >> 8) & 0x00FF00FF) | ((*pBuffer << 8) & 0xFF00FF00);
             }
         }
+#endif
     }
 
     return true;
@@ -1333,6 +1872,50 @@ static bool romGetDebug64(Rom* pROM, u32 nAddress, s64* pData) {
     return true;
 }
 
+#ifdef SIM_PERF
+// Sorts the `anOffsetBlock` ranges by their start offset so `romCopyLoop` can binary search them
+static void romSortOffsetBlocks(Rom* pROM) {
+    s32 i;
+    s32 j;
+    u32 nOffset0;
+    u32 nOffset1;
+
+    for (i = 2; i < pROM->nCountOffsetBlocks; i += 2) {
+        nOffset0 = pROM->anOffsetBlock[i];
+        nOffset1 = pROM->anOffsetBlock[i + 1];
+        for (j = i; j > 0 && pROM->anOffsetBlock[j - 2] > nOffset0; j -= 2) {
+            pROM->anOffsetBlock[j] = pROM->anOffsetBlock[j - 2];
+            pROM->anOffsetBlock[j + 1] = pROM->anOffsetBlock[j - 1];
+        }
+        pROM->anOffsetBlock[j] = nOffset0;
+        pROM->anOffsetBlock[j + 1] = nOffset1;
+    }
+}
+
+static bool romFindOffsetBlock(Rom* pROM, u32 nOffset, s32* piRange) {
+    s32 iLow;
+    s32 iHigh;
+    s32 iMiddle;
+
+    iLow = 0;
+    iHigh = (pROM->nCountOffsetBlocks >> 1) - 1;
+
+    while (iLow <= iHigh) {
+        iMiddle = (iLow + iHigh) >> 1;
+        if (nOffset < pROM->anOffsetBlock[iMiddle * 2]) {
+            iHigh = iMiddle - 1;
+        } else if (nOffset > pROM->anOffsetBlock[iMiddle * 2 + 1]) {
+            iLow = iMiddle + 1;
+        } else {
+            *piRange = iMiddle * 2;
+            return true;
+        }
+    }
+
+    return false;
+}
+#endif
+
 static inline bool romCopyLoad(Rom* pROM) {
     if (!romLoadFullOrPart(pROM)) {
         return false;
@@ -1342,6 +1925,10 @@ static inline bool romCopyLoad(Rom* pROM) {
         return false;
     }
 
+#ifdef SIM_PERF
+    romSortOffsetBlocks(pROM);
+#endif
+
     pROM->bLoad = false;
     return true;
 }
@@ -1355,6 +1942,16 @@ static inline bool romCopyLoop(Rom* pROM, u8* pTarget, u32 nOffset, u32 nSize, U
     pROM->copy.nOffset = nOffset;
     pROM->copy.pCallback = pCallback;
 
+#ifdef SIM_PERF
+    pROM->iBlockWait = -1;
+    if (!romFindOffsetBlock(pROM, nOffset, &i)) {
+        return false;
+    }
+
+    pROM->load.nOffset0 = pROM->anOffsetBlock[i];
+    pROM->load.nOffset1 = pROM->anOffsetBlock[i + 1];
+    return true;
+#else
     for (i = 0; i < pROM->nCountOffsetBlocks; i += 2) {
         if ((pROM->anOffsetBlock[i] <= nOffset) && (nOffset <= pROM->anOffsetBlock[i + 1])) {
             pROM->load.nOffset0 = pROM->anOffsetBlock[i];
@@ -1364,6 +1961,7 @@ static inline bool romCopyLoop(Rom* pROM, u8* pTarget, u32 nOffset, u32 nSize, U
     }
 
     return false;
+#endif
 }
 
 bool romCopy(Rom* pROM, void* pTarget, s32 nOffset, s32 nSize, UnknownCallbackFunc* pCallback) {
@@ -1416,6 +2014,16 @@ bool romCopy(Rom* pROM, void* pTarget, s32 nOffset, s32 nSize, UnknownCallbackFu
     }
 
     if (pROM->eModeLoad == RLM_FULL) {
+#ifdef SIM_PERF
+        if (pROM->pTrace != NULL && nSize > 0) {
+            u32 iBlock;
+
+            for (iBlock = nOffset / 0x2000; iBlock <= (nOffset + nSize - 1) / 0x2000; iBlock++) {
+                romTraceBlock(pROM, iBlock);
+            }
+        }
+#endif
+
         if (!xlHeapCopy(pTarget, (void*)((u32)pROM->pBuffer + nOffset), nSize)) {
             return false;
         }
@@ -1465,6 +2073,10 @@ bool romCopyImmediate(Rom* pROM, void* pTarget, s32 nOffsetROM, s32 nSize) {
             if (pBlock->nSize == 0) {
                 return false;
             }
+#ifdef SIM_PERF
+            romTraceBlock(pROM, nOffsetROM / 0x2000);
+            pROM->stats.nCountHit++;
+#endif
 
             nOffsetBlock = nOffsetROM % 0x2000;
             if ((nSizeCopy = pBlock->nSize - nOffsetBlock) > nSize) {
@@ -1523,6 +2135,12 @@ bool romCopyImmediate(Rom* pROM, void* pTarget, s32 nOffsetROM, s32 nSize) {
 bool romUpdate(Rom* pROM) {
     s32 nStatus;
 
+#ifdef SIM_PERF
+    if (!romTransferUpdate(pROM)) {
+        return false;
+    }
+#endif
+
     if (pROM->copy.bWait || pROM->load.bWait) {
         if (pROM->load.bDone && pROM->load.nResult == pROM->load.nSizeRead) {
             pROM->load.bDone = false;
@@ -1556,6 +2174,12 @@ bool romUpdate(Rom* pROM) {
         return false;
     }
 
+#ifdef SIM_PERF
+    if (!romTransferDemoteOldest(pROM)) {
+        return false;
+    }
+#endif
+
     return true;
 }
 
@@ -1582,6 +2206,209 @@ bool romSetCacheSize(Rom* pROM, s32 nSize) {
     return true;
 }
 
+#ifdef SIM_PERF
+static bool romGetHexToken(char** pszText, u32* pnValue) {
+    char* szText;
+    u32 nValue;
+    s32 nDigit;
+
+    szText = *pszText;
+    while (*szText == ' ' || *szText == '\t' || *szText == ',') {
+        szText++;
+    }
+    if (szText[0] == '0' && (szText[1] == 'x' || szText[1] == 'X')) {
+        szText += 2;
+    }
+
+    nValue = 0;
+    for (nDigit = 0;; nDigit++, szText++) {
+        if (*szText >= '0' && *szText <= '9') {
+            nValue = (nValue << 4) | (*szText - '0');
+        } else if (*szText >= 'A' && *szText <= 'F') {
+            nValue = (nValue << 4) | (*szText - 'A' + 10);
+        } else if (*szText >= 'a' && *szText <= 'f') {
+            nValue = (nValue << 4) | (*szText - 'a' + 10);
+        } else {
+            break;
+        }
+    }
+
+    *pszText = szText;
+    *pnValue = nValue;
+    return nDigit != 0;
+}
+
+// Converts an extent size in bytes into a block count, rounding down to a power of two between 8 KiB and 64 KiB
+static s32 romGetExtentBlocks(u32 nSize) {
+    s32 nCountBlock;
+
+    for (nCountBlock = 1; nCountBlock < ROM_EXTENT_BLOCKS_MAX; nCountBlock <<= 1) {
+        if (nSize < (nCountBlock << 1) * 0x2000) {
+            break;
+        }
+    }
+
+    return nCountBlock;
+}
+
+bool romSetExtentSize(Rom* pROM, s32 nSize) {
+    pROM->nCountBlockExtent = romGetExtentBlocks(nSize);
+    return true;
+}
+
+// Reads the pin set written by `tools/rom_pinset.py` for this game: one inclusive "<begin> <end>" pair of hex ROM
+// offsets per line, most valuable range first. Lines of the form "X <begin> <end> <size>" set the extent size used
+// to load that region instead. Lines starting with '#' are comments.
+static bool romReadPinSet(Rom* pROM) {
+    tXL_FILE* pFile;
+    char* szText;
+    char* acText;
+    s32 nSize;
+    u32 nOffset0;
+    u32 nOffset1;
+    u32 nSizeExtent;
+    char acName[9];
+
+    pROM->nCountPinRange = 0;
+    pROM->nCountExtent = 0;
+
+    romGetCode(pROM, acName);
+    acName[4] = '.';
+    acName[5] = 'P';
+    acName[6] = 'I';
+    acName[7] = 'N';
+    acName[8] = '\0';
+
+    if (!xlFileOpen(&pFile, XLFT_TEXT, acName)) {
+        return true;
+    }
+
+    // Read the whole file with one DVD request; a failed resize keeps the default window
+    nSize = pFile->nSize;
+    xlFileSetReadAhead(pFile, nSize);
+    if (!xlHeapTake((void**)&acText, nSize + 1)) {
+        xlFileClose(&pFile);
+        return false;
+    }
+    if (!xlFileGet(pFile, acText, nSize)) {
+        nSize = 0;
+    }
+    acText[nSize] = '\0';
+
+    if (!xlFileClose(&pFile)) {
+        return false;
+    }
+
+    for (szText = acText; *szText != '\0';) {
+        if (*szText == 'X') {
+            szText++;
+            if (romGetHexToken(&szText, &nOffset0) && romGetHexToken(&szText, &nOffset1) &&
+                romGetHexToken(&szText, &nSizeExtent) && nOffset0 <= nOffset1 &&
+                pROM->nCountExtent < ARRAY_COUNT(pROM->aExtent)) {
+                pROM->aExtent[pROM->nCountExtent].nOffset0 = nOffset0;
+                pROM->aExtent[pROM->nCountExtent].nOffset1 = nOffset1;
+                pROM->aExtent[pROM->nCountExtent].nCountBlock = romGetExtentBlocks(nSizeExtent);
+                pROM->nCountExtent++;
+            }
+        } else if (*szText != '#' && romGetHexToken(&szText, &nOffset0) && romGetHexToken(&szText, &nOffset1) &&
+                   nOffset0 <= nOffset1 && pROM->nCountPinRange < ARRAY_COUNT(pROM->anPinRange)) {
+            pROM->anPinRange[pROM->nCountPinRange++] = nOffset0;
+            pROM->anPinRange[pROM->nCountPinRange++] = nOffset1;
+        }
+        while (*szText != '\0' && *szText != '\n') {
+            szText++;
+        }
+        if (*szText == '\n') {
+            szText++;
+        }
+    }
+
+    if (!xlHeapFree((void**)&acText)) {
+        return false;
+    }
+
+    return true;
+}
+
+bool romSetTrace(Rom* pROM, bool bTrace) {
+    s32 iBlock;
+
+    if (!bTrace) {
+        if (pROM->pTrace != NULL && !xlHeapFree((void**)&pROM->pTrace)) {
+            return false;
+        }
+        return true;
+    }
+
+    if (pROM->pTrace == NULL && !xlHeapTake((void**)&pROM->pTrace, sizeof(RomTrace))) {
+        return false;
+    }
+
+    pROM->pTrace->nTickStart = OSGetTick();
+    for (iBlock = 0; iBlock < ARRAY_COUNT(pROM->pTrace->aBlock); iBlock++) {
+        pROM->pTrace->aBlock[iBlock].nTimeFirst = 0;
+        pROM->pTrace->aBlock[iBlock].nCount = 0;
+    }
+
+    return true;
+}
+
+// Prints every touched block as "ROMTRACE <code> <block> <first-ms> <count>" for `tools/rom_pinset.py`. The trace
+// is cumulative, so each dump supersedes the last.
+bool romDumpTrace(Rom* pROM) {
+    RomTraceBlock* pTraceBlock;
+    s32 iBlock;
+    char acCode[5];
+
+    if (pROM->pTrace == NULL) {
+        return true;
+    }
+
+    romGetCode(pROM, acCode);
+    for (iBlock = 0; iBlock < ARRAY_COUNT(pROM->pTrace->aBlock); iBlock++) {
+        pTraceBlock = &pROM->pTrace->aBlock[iBlock];
+        if (pTraceBlock->nCount != 0) {
+            OSReport("ROMTRACE %s %d %u %u\n", acCode, iBlock, pTraceBlock->nTimeFirst, pTraceBlock->nCount);
+        }
+    }
+
+    return true;
+}
+
+// Prints the DVD reads and cache hit rate since the last dump
+bool romDumpStats(Rom* pROM) {
+    u32 nCountLookup;
+    char acCode[5];
+
+    romGetCode(pROM, acCode);
+    nCountLookup = pROM->stats.nCountHit + pROM->stats.nCountMiss;
+    OSReport("ROMSTATS %s extent=0x%X reads=%u bytes=%u hits=%u misses=%u hit-rate=%u%%\n", acCode,
+             pROM->nCountBlockExtent * 0x2000, pROM->stats.nCountRead, pROM->stats.nSizeRead, pROM->stats.nCountHit,
+             pROM->stats.nCountMiss, nCountLookup == 0 ? 0 : pROM->stats.nCountHit * 100 / nCountLookup);
+
+    pROM->stats.nCountRead = 0;
+    pROM->stats.nSizeRead = 0;
+    pROM->stats.nCountHit = 0;
+    pROM->stats.nCountMiss = 0;
+    return true;
+}
+#endif
+
+#ifdef SIM_PERF
+static inline void romOpen(Rom* pROM, char* szNameFile) {
+    if (pROM->acHeader[0] == 0x37 && pROM->acHeader[1] == 0x80) {
+        pROM->eByteOrder = RBO_SWAP16;
+    } else if (pROM->acHeader[0] == 0x40 && pROM->acHeader[1] == 0x12) {
+        pROM->eByteOrder = RBO_SWAP32;
+    } else {
+        pROM->eByteOrder = RBO_NONE;
+    }
+
+    // The header was read straight from the image, so the game code is only readable in big-endian order
+    romSwapBuffer(pROM->acHeader, sizeof(pROM->acHeader), pROM->eByteOrder);
+    simulatorDVDOpen(szNameFile, &pROM->fileInfo);
+}
+#else
 static inline void romOpen(Rom* pROM, char* szNameFile) {
     bool var_r30 = false;
     bool bFlip;
@@ -1599,6 +2426,7 @@ static inline void romOpen(Rom* pROM, char* szNameFile) {
     pROM->bFlip = bFlip;
     simulatorDVDOpen(szNameFile, &pROM->fileInfo);
 }
+#endif
 
 bool romSetImage(Rom* pROM, char* szNameFile) {
 #if VERSION == CE_P
@@ -1660,9 +2488,29 @@ bool romSetImage(Rom* pROM, char* szNameFile) {
 
     romOpen(pROM, szNameFile);
 
+#ifdef SIM_PERF
+#ifdef SIM_PERF_ROM_EXTENT
+    if (!romSetExtentSize(pROM, SIM_PERF_ROM_EXTENT)) {
+        return false;
+    }
+#endif
+    if (!romReadPinSet(pROM)) {
+        return false;
+    }
+#ifdef SIM_PERF_ROM_TRACE
+    if (!romSetTrace(pROM, true)) {
+        return false;
+    }
+#endif
+#endif
+
 #if VERSION == CE_P
     pROM->tagFile.nMode = 0;
     if (xlFileOpen(&pFile, XLFT_TEXT, "ROMS.TAG")) {
+#ifdef SIM_PERF
+        // The tags are scanned a character at a time, so buffer the whole file
+        xlFileSetReadAhead(pFile, pFile->nSize);
+#endif
         while (romGetTagToken(pROM, pFile, &eToken, acToken)) {
             if (eToken == RTT_CODE) {
                 s32 nMode = pROM->tagFile.nMode | 0x100;
@@ -1706,7 +2554,11 @@ bool romEvent(Rom* pROM, s32 nEvent, void* pArgument) {
             pROM->nSize = 0;
             pROM->nTick = 0;
             pROM->bLoad = true;
+#ifdef SIM_PERF
+            pROM->eByteOrder = RBO_NONE;
+#else
             pROM->bFlip = false;
+#endif
             pROM->pHost = pArgument;
             pROM->acNameFile[0] = '\0';
             pROM->eModeLoad = RLM_NONE;
@@ -1714,12 +2566,29 @@ bool romEvent(Rom* pROM, s32 nEvent, void* pArgument) {
             pROM->offsetToRom = 0;
             pROM->anOffsetBlock = NULL;
             pROM->nCountOffsetBlocks = 0;
+#ifdef SIM_PERF
+            pROM->nCountPinRange = 0;
+            pROM->pTrace = NULL;
+            pROM->nCountExtent = 0;
+            pROM->nCountBlockExtent = 1;
+            pROM->pExtentBuffer = NULL;
+            pROM->stats.nCountRead = 0;
+            pROM->stats.nSizeRead = 0;
+            pROM->stats.nCountHit = 0;
+            pROM->stats.nCountMiss = 0;
+            pROM->iBlockWait = -1;
+#endif
             pROM->copy.nSize = 0;
             pROM->copy.bWait = false;
             pROM->load.bWait = false;
             pROM->load.nOffset1 = 0;
             pROM->load.nOffset0 = 0;
             pROM->load.bDone = false;
+#ifdef SIM_PERF
+            pROM->transfer.bActive = false;
+            pROM->transfer.iHead = 0;
+            pROM->transfer.nCount = 0;
+#endif
 #if VERSION == CE_P
             pROM->tagFile.nMode = 0;
 #endif
@@ -1728,9 +2597,22 @@ bool romEvent(Rom* pROM, s32 nEvent, void* pArgument) {
             pROM->pCacheRAM = NULL;
             break;
         case 3:
+#ifdef SIM_PERF
+            if (!romTransferWait(pROM, -1)) {
+                return false;
+            }
+#endif
             if ((pROM->pBuffer != NULL) && (pROM->pBuffer != pROM->pCacheRAM) && (!xlHeapFree(&pROM->pBuffer))) {
                 return false;
             }
+#ifdef SIM_PERF
+            if (pROM->pExtentBuffer != NULL && !xlHeapFree((void**)&pROM->pExtentBuffer)) {
+                return false;
+            }
+            if (!romDumpTrace(pROM) || !romSetTrace(pROM, false)) {
+                return false;
+            }
+#endif
             break;
         case 0x1002:
             switch (((CpuDevice*)pArgument)->nType) {
@@ -1770,3 +2652,4 @@ bool romEvent(Rom* pROM, s32 nEvent, void* pArgument) {
 
     return true;
 }
+
@@ -646,8 +646,13 @@ bool rspUpdate(Rsp* pRSP, RspUpdateMode eMode) {
         if (pRSP->nMode & 0x20) {
             pRSP->nMode &= ~0x30;
             pRSP->nStatus |= 0x201;
+#ifdef SIM_PERF
+            systemRaiseInterrupt(pRSP->pHost, SIT_SP);
+            systemRaiseInterrupt(pRSP->pHost, SIT_DP);
+#else
             xlObjectEvent(pRSP->pHost, 0x1000, (void*)5);
             xlObjectEvent(pRSP->pHost, 0x1000, (void*)10);
+#endif
         } else {
             if (pRSP->nMode & 2) {
                 if (frameBeginOK(pFrame) && eMode == RUM_IDLE) {
@@ -672,8 +677,13 @@ bool rspUpdate(Rsp* pRSP, RspUpdateMode eMode) {
                     if (bDone) {
                         pRSP->nMode &= ~0x10;
                         pRSP->nStatus |= 0x201;
+#ifdef SIM_PERF
+                        systemRaiseInterrupt(pRSP->pHost, SIT_SP);
+                        systemRaiseInterrupt(pRSP->pHost, SIT_DP);
+#else
                         xlObjectEvent(pRSP->pHost, 0x1000, (void*)5);
                         xlObjectEvent(pRSP->pHost, 0x1000, (void*)10);
+#endif
                     }
                 } else {
                     __cpuBreak(SYSTEM_CPU(pRSP->pHost));
@@ -36,7 +36,11 @@ bool serialPut32(Serial* pSerial, u32 nAddress, s32* pData) {
                 return false;
             }
 
+#ifdef SIM_PERF
+            systemRaiseInterrupt(pSerial->pHost, SIT_SI);
+#else
             xlObjectEvent(pSerial->pHost, 0x1000, (void*)6);
+#endif
             break;
         case 0x10:
             nSize = 0x40;
@@ -49,10 +53,18 @@ bool serialPut32(Serial* pSerial, u32 nAddress, s32* pData) {
                 return false;
             }
 
+#ifdef SIM_PERF
+            systemRaiseInterrupt(pSerial->pHost, SIT_SI);
+#else
             xlObjectEvent(pSerial->pHost, 0x1000, (void*)6);
+#endif
             break;
         case 0x18:
+#ifdef SIM_PERF
+            systemClearInterrupt(pSerial->pHost, SIT_SI);
+#else
             xlObjectEvent(pSerial->pHost, 0x1001, (void*)6);
+#endif
             break;
         default:
             return false;
@@ -1470,6 +1470,35 @@ STATIC bool systemSetupGameALL(System* pSystem) {
     return true;
 }
 
+#ifdef SIM_PERF
+static SystemException gaSystemException[SIT_COUNT] = {
+    {"SW0", 5, CEC_INTERRUPT, SIT_SW0, MIT_NONE},
+    {"SW1", 6, CEC_INTERRUPT, SIT_SW1, MIT_NONE},
+    {"CART", 0xC, CEC_INTERRUPT, SIT_CART, MIT_NONE},
+    {"COUNTER", 0x84, CEC_INTERRUPT, SIT_COUNTER, MIT_NONE},
+    {"RDB", 0x24, CEC_INTERRUPT, SIT_RDB, MIT_NONE},
+    {"SP", 4, CEC_INTERRUPT, SIT_SP, MIT_SP},
+    {"SI", 4, CEC_INTERRUPT, SIT_SI, MIT_SI},
+    {"AI", 4, CEC_INTERRUPT, SIT_AI, MIT_AI},
+    {"VI", 4, CEC_INTERRUPT, SIT_VI, MIT_VI},
+    {"PI", 4, CEC_INTERRUPT, SIT_PI, MIT_PI},
+    {"DP", 4, CEC_INTERRUPT, SIT_DP, MIT_DP},
+    {"BREAK (CPU)", 0, CEC_BREAK, SIT_CPU_BREAK, MIT_NONE},
+    {"BREAK (SP)", 4, CEC_INTERRUPT, SIT_SP_BREAK, MIT_NONE},
+    {"FAULT", 0, CEC_NONE, SIT_FAULT, MIT_NONE},
+    {"THREADSTATUS", 0, CEC_NONE, SIT_THREADSTATUS, MIT_NONE},
+    {"PRENMI", 0, CEC_INTERRUPT, SIT_PRENMI, MIT_NONE},
+};
+
+static bool systemGetException(System* pSystem, SystemInterruptType eType, SystemException* pException) {
+    if ((eType > SIT_NONE) && (eType < SIT_COUNT)) {
+        *pException = gaSystemException[eType];
+        return true;
+    }
+
+    return false;
+}
+#else
 static bool systemGetException(System* pSystem, SystemInterruptType eType, SystemException* pException) {
     pException->nMask = 0;
     pException->szType = "";
@@ -1564,6 +1593,7 @@ static bool systemGetException(System* pSystem, SystemInterruptType eType, Syste
 
     return true;
 }
+#endif
 
 static bool systemGet8(System* pSystem, u32 nAddress, s8* pData) {
     *pData = 0;
@@ -1807,6 +1837,61 @@ bool systemExecute(System* pSystem, s32 nCount) {
     return true;
 }
 
+#ifdef SIM_PERF
+// Pending interrupts are walked in type order, highest bit (SIT_SW0) first.
+bool systemCheckInterrupts(System* pSystem) {
+    u32 nMask;
+    u32 nMaskType;
+    s32 nMaskFinal;
+    SystemException* pException;
+    CpuExceptionCode eCodeFinal;
+
+    if ((nMask = pSystem->nMaskException) == 0) {
+        pSystem->bException = false;
+        return true;
+    }
+
+    nMaskFinal = 0;
+    eCodeFinal = CEC_NONE;
+
+    while (nMask != 0) {
+        pException = &gaSystemException[__cntlzw(nMask)];
+        nMaskType = SYSTEM_INTERRUPT_BIT(pException->eType);
+        nMask &= ~nMaskType;
+
+        if (pException->eCode == CEC_INTERRUPT) {
+            if (!cpuTestInterrupt(SYSTEM_CPU(pSystem), pException->nMask) ||
+                ((pException->eTypeMips != MIT_NONE) &&
+                 !mipsSetInterrupt(SYSTEM_MIPS(pSystem), pException->eTypeMips))) {
+                continue;
+            }
+        } else {
+            if (nMaskFinal == 0) {
+                eCodeFinal = pException->eCode;
+                pSystem->nMaskException &= ~nMaskType;
+            }
+            break;
+        }
+
+        nMaskFinal |= pException->nMask;
+        pSystem->nMaskException &= ~nMaskType;
+    }
+
+    pSystem->bException = pSystem->nMaskException != 0;
+
+    if (nMaskFinal != 0) {
+        if (!cpuException(SYSTEM_CPU(pSystem), CEC_INTERRUPT, nMaskFinal)) {
+            return false;
+        }
+    } else {
+        if ((eCodeFinal != CEC_NONE) && !cpuException(SYSTEM_CPU(pSystem), eCodeFinal, 0)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+#else
 bool systemCheckInterrupts(System* pSystem) {
     s32 iException;
     s32 nMaskFinal;
@@ -1866,10 +1951,16 @@ bool systemCheckInterrupts(System* pSystem) {
 
     return true;
 }
+#endif
 
 bool systemExceptionPending(System* pSystem, SystemInterruptType nException) {
+#ifdef SIM_PERF
+    if ((nException > SIT_NONE) && (nException < SIT_COUNT)) {
+        if (pSystem->nMaskException & SYSTEM_INTERRUPT_BIT(nException)) {
+#else
     if ((nException > -1) && (nException < ARRAY_COUNT(pSystem->anException))) {
         if (pSystem->anException[nException] != 0) {
+#endif
             return true;
         }
 
@@ -1879,19 +1970,164 @@ bool systemExceptionPending(System* pSystem, SystemInterruptType nException) {
     return false;
 }
 
+#ifdef SIM_PERF
+// Fast path for devices raising an interrupt, bypassing `xlObjectEvent`.
+bool systemRaiseInterrupt(System* pSystem, SystemInterruptType eType) {
+    if ((eType > SIT_NONE) && (eType < SIT_COUNT)) {
+        pSystem->bException = true;
+        pSystem->nMaskException |= SYSTEM_INTERRUPT_BIT(eType);
+        pSystem->anCountInterrupt[eType]++;
+        return true;
+    }
+
+    return false;
+}
+
+bool systemClearInterrupt(System* pSystem, SystemInterruptType eType) {
+    SystemException exception;
+
+    if (!systemGetException(pSystem, eType, &exception)) {
+        return false;
+    }
+    if (exception.eTypeMips != MIT_NONE) {
+        mipsResetInterrupt(SYSTEM_MIPS(pSystem), exception.eTypeMips);
+    }
+
+    return true;
+}
+
+bool systemDumpInterrupts(System* pSystem) {
+    SystemException exception;
+    OSTick nTick;
+    u32 nTime;
+    u32 nCount;
+    int iType;
+
+    nTick = OSGetTick();
+    nTime = OSTicksToMilliseconds(nTick - pSystem->nTickInterrupt);
+
+    for (iType = 0; iType < SIT_COUNT; iType++) {
+        if ((nCount = pSystem->anCountInterrupt[iType]) == 0) {
+            continue;
+        }
+        if (!systemGetException(pSystem, iType, &exception)) {
+            return false;
+        }
+        OSReport("SYSINT %-6s %8u %6u/s\n", exception.szType, nCount,
+                 nTime == 0 ? 0 : (u32)(((u64)nCount * 1000) / nTime));
+        pSystem->anCountInterrupt[iType] = 0;
+    }
+
+    pSystem->nTickInterrupt = nTick;
+    return true;
+}
+
+// Physical address the CPU writes GX commands to next (PI FIFO write pointer, without the wrap flag)
+static inline u32 systemGetFifoWrite(void) { return *(vu32*)OSPhysicalToUncached(0x0C003014) & 0x03FFFFFF; }
+
+// Prints the emulator statistics every `nFrameDump` frames (0 disables).
+bool systemSetStatsDump(System* pSystem, s32 nFrameDump) {
+    int iType;
+
+    for (iType = 0; iType < SIT_COUNT; iType++) {
+        pSystem->anCountInterrupt[iType] = 0;
+    }
+    pSystem->nTickInterrupt = OSGetTick();
+    pSystem->nFrameStats = 0;
+    pSystem->nFrameDumpStats = nFrameDump;
+    pSystem->nFifoWrite = systemGetFifoWrite();
+    pSystem->nSizeFifo = 0;
+    return xlHeapSetTelemetry(nFrameDump > 0);
+}
+
+// Called on each forced retrace (see `videoForceRetrace`).
+bool systemUpdateStats(System* pSystem) {
+    u32 nFifoWrite;
+    u32 nSize;
+
+    if (pSystem->nFrameDumpStats <= 0) {
+        return true;
+    }
+
+    // The FIFO is a ring, so this assumes less than one lap of it (256 KiB) per frame
+    nFifoWrite = systemGetFifoWrite();
+    if ((nSize = GXGetFifoSize(GXGetCPUFifo())) != 0) {
+        pSystem->nSizeFifo += (nFifoWrite - pSystem->nFifoWrite + nSize) % nSize;
+    }
+    pSystem->nFifoWrite = nFifoWrite;
+
+    if (!xlHeapUpdateTelemetry()) {
+        return false;
+    }
+
+    if (!rdpUpdateStats(SYSTEM_RDP(pSystem))) {
+        return false;
+    }
+
+    if (++pSystem->nFrameStats >= pSystem->nFrameDumpStats) {
+        pSystem->nFrameStats = 0;
+        if (!systemDumpStats(pSystem)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool systemDumpStats(System* pSystem) {
+    if (!systemDumpInterrupts(pSystem)) {
+        return false;
+    }
+
+    OSReport("GXFIFO %u bytes in %d frames, %u per frame\n", pSystem->nSizeFifo, pSystem->nFrameDumpStats,
+             pSystem->nFrameDumpStats > 0 ? pSystem->nSizeFifo / pSystem->nFrameDumpStats : 0);
+    pSystem->nSizeFifo = 0;
+
+    if (!rdpDumpStats(SYSTEM_RDP(pSystem))) {
+        return false;
+    }
+
+    if (!romDumpStats(SYSTEM_ROM(pSystem))) {
+        return false;
+    }
+
+    if (!romDumpTrace(SYSTEM_ROM(pSystem))) {
+        return false;
+    }
+
+    if (!xlFileDumpStats()) {
+        return false;
+    }
+
+    if (!xlHeapDumpTelemetry()) {
+        return false;
+    }
+
+    return true;
+}
+#endif
+
 static inline bool systemClearExceptions(System* pSystem) {
+#ifndef SIM_PERF
     int iException;
+#endif
 
     pSystem->bException = false;
+#ifdef SIM_PERF
+    pSystem->nMaskException = 0;
+#else
     for (iException = 0; iException < 16; iException++) {
         pSystem->anException[iException] = 0;
     }
+#endif
     return true;
 }
 
 bool systemEvent(System* pSystem, s32 nEvent, void* pArgument) {
     Cpu* pCPU;
+#ifndef SIM_PERF
     SystemException exception;
+#endif
     SystemObjectType eObject;
     SystemObjectType storageDevice;
 
@@ -1929,6 +2165,9 @@ bool systemEvent(System* pSystem, s32 nEvent, void* pArgument) {
 #endif
 
             systemClearExceptions(pSystem);
+#ifdef SIM_PERF
+            systemSetStatsDump(pSystem, SIM_PERF_STATS);
+#endif
 
             for (eObject = 0; eObject < SOT_COUNT; eObject++) {
                 switch (eObject) {
@@ -2085,20 +2324,33 @@ bool systemEvent(System* pSystem, s32 nEvent, void* pArgument) {
             }
             break;
         case 0x1001:
+#ifdef SIM_PERF
+            if (!systemClearInterrupt(pSystem, (SystemInterruptType)(s32)pArgument)) {
+                return false;
+            }
+#else
             if (!systemGetException(pSystem, (SystemInterruptType)(s32)pArgument, &exception)) {
                 return false;
             }
             if (exception.eTypeMips != MIT_NONE) {
                 mipsResetInterrupt(SYSTEM_MIPS(pSystem), exception.eTypeMips);
             }
+#endif
             break;
         case 0x1000:
+#ifdef SIM_PERF
+            if (!systemRaiseInterrupt(pSystem, (SystemInterruptType)(s32)pArgument)) {
+                return false;
+            }
+            break;
+#else
             if (((SystemInterruptType)(s32)pArgument > SIT_NONE) && ((SystemInterruptType)(s32)pArgument < SIT_COUNT)) {
                 pSystem->bException = true;
                 pSystem->anException[(SystemInterruptType)(s32)pArgument]++;
                 break;
             }
             return false;
+#endif
         case 0x1002:
             if (!cpuSetDevicePut(SYSTEM_CPU(pSystem), pArgument, (Put8Func)systemPut8, (Put16Func)systemPut16,
                                  (Put32Func)systemPut32, (Put64Func)systemPut64)) {
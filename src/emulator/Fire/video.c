@@ -50,7 +50,11 @@ bool videoPut32(Video* pVideo, u32 nAddress, s32* pData) {
             pVideo->nScanInterrupt = *pData & 0x3FF;
             break;
         case 0x10:
+#ifdef SIM_PERF
+            systemClearInterrupt(pVideo->pHost, SIT_VI);
+#else
             xlObjectEvent(pVideo->pHost, 0x1001, (void*)8);
+#endif
             pVideo->nScanInterrupt = 0x10000;
             break;
         case 0x14:
@@ -164,7 +168,12 @@ bool videoGet64(Video* pVideo, u32 nAddress, s64* pData) { return false; }
 bool videoForceRetrace(Video* pVideo, bool unknown) {
     if (!systemExceptionPending(pVideo->pHost, SIT_VI) && (pVideo->nStatus & 3)) {
         pVideo->nScan = pVideo->nScanInterrupt;
+#ifdef SIM_PERF
+        systemRaiseInterrupt(pVideo->pHost, SIT_VI);
+        systemUpdateStats(pVideo->pHost);
+#else
         xlObjectEvent(pVideo->pHost, 0x1000, (void*)8);
+#endif
         return true;
     }
 
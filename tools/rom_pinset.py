@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+
+###
+# Builds ROM cache pin sets from ROM access traces.
+#
+# A trace is the debug output of a `--perf --rom-trace` build, where
+# `romDumpTrace` prints one "ROMTRACE <code> <block> <first-ms> <count>" line
+# per touched 8 KiB block. The trace is cumulative, so only the last dump in
+# each file is used and each file counts as one session. Several sessions can
+# be passed at once; blocks are ranked by how many sessions touched them, how
+# early they were first touched and how often they were used. The best blocks
+# are merged into ranges that fit in the pin budget and written to
+# "<code>.PIN", which `romSetImage` loads from the disc root.
+#
+# Runs of touched blocks that are not pinned are streamed in on demand. For
+# each long run an "X <begin> <end> <size>" line is written so the emulator
+# loads it with larger DVD reads (see `Rom::aExtent`).
+#
+# Usage:
+#   python3 tools/rom_pinset.py session1.log session2.log -o files/
+###
+
+import argparse
+import os
+import re
+from collections import defaultdict
+from typing import Dict, List, Tuple
+
+BLOCK_SIZE = 0x2000
+MAX_RANGES = 64  # see `Rom::anPinRange`
+MAX_EXTENTS = 16  # see `Rom::aExtent`
+MAX_EXTENT_BLOCKS = 8  # see `ROM_EXTENT_BLOCKS_MAX`
+
+trace_pattern = re.compile(r"ROMTRACE\s+(\w{4})\s+(\d+)\s+(\d+)\s+(\d+)")
+
+
+class BlockStats:
+    def __init__(self) -> None:
+        self.sessions = 0
+        self.first_ms = 0
+        self.count = 0
+
+
+def read_traces(paths: List[str]) -> Dict[str, Dict[int, BlockStats]]:
+    games: Dict[str, Dict[int, BlockStats]] = defaultdict(lambda: defaultdict(BlockStats))
+
+    for path in paths:
+        # Later dumps of the same session supersede earlier ones
+        session: Dict[Tuple[str, int], Tuple[int, int]] = {}
+        with open(path, encoding="utf-8", errors="replace") as file:
+            for line in file:
+                match = trace_pattern.search(line)
+                if match is None:
+                    continue
+                code, block, first_ms, count = match.groups()
+                session[(code, int(block))] = (int(first_ms), int(count))
+
+        for (code, block), (first_ms, count) in session.items():
+            stats = games[code][block]
+            if stats.sessions == 0 or first_ms < stats.first_ms:
+                stats.first_ms = first_ms
+            stats.sessions += 1
+            stats.count += count
+
+    return games
+
+
+def rank_blocks(blocks: Dict[int, BlockStats], budget: int) -> List[int]:
+    def score(item: Tuple[int, BlockStats]) -> Tuple[int, int, int]:
+        _, stats = item
+        return (-stats.sessions, stats.first_ms, -stats.count)
+
+    ranked = sorted(blocks.items(), key=score)
+    return [block for block, _ in ranked[:budget]]
+
+
+def range_blocks(ranges: List[Tuple[int, int, int]]) -> int:
+    return sum(end - begin + 1 for begin, end, _ in ranges)
+
+
+def add_block(ranges: List[Tuple[int, int, int]], block: int, rank: int) -> List[Tuple[int, int, int]]:
+    ranges = sorted(ranges + [(block, block, rank)])
+
+    # Join touching ranges, then merge the closest neighbours if the range
+    # table no longer fits
+    joined: List[Tuple[int, int, int]] = []
+    for begin, end, best in ranges:
+        if joined and joined[-1][1] >= begin - 1:
+            joined[-1] = (joined[-1][0], max(joined[-1][1], end), min(joined[-1][2], best))
+        else:
+            joined.append((begin, end, best))
+
+    while len(joined) > MAX_RANGES:
+        gaps = [joined[i + 1][0] - joined[i][1] for i in range(len(joined) - 1)]
+        i = gaps.index(min(gaps))
+        joined[i : i + 2] = [(joined[i][0], joined[i + 1][1], min(joined[i][2], joined[i + 1][2]))]
+
+    return joined
+
+
+def make_ranges(blocks: List[int], budget: int) -> List[Tuple[int, int, int]]:
+    # Blocks are added best first. Merging pins the blocks in the gaps as
+    # well, so a block is skipped if the merged ranges would exceed the budget.
+    # The rank of the best block in each range is kept so the most valuable
+    # ranges are loaded first.
+    ranges: List[Tuple[int, int, int]] = []
+
+    for rank, block in enumerate(blocks):
+        merged = add_block(ranges, block, rank)
+        if range_blocks(merged) <= budget:
+            ranges = merged
+
+    return sorted(ranges, key=lambda r: r[2])
+
+
+def make_extents(
+    blocks: Dict[int, BlockStats], ranges: List[Tuple[int, int, int]]
+) -> List[Tuple[int, int, int]]:
+    pinned_set = {block for begin, end, _ in ranges for block in range(begin, end + 1)}
+    runs: List[Tuple[int, int]] = []
+
+    for block in sorted(set(blocks) - pinned_set):
+        if runs and runs[-1][1] == block - 1:
+            runs[-1] = (runs[-1][0], block)
+        else:
+            runs.append((block, block))
+
+    extents: List[Tuple[int, int, int]] = []
+    for begin, end in runs:
+        length = end - begin + 1
+        if length < 2:
+            continue
+        count = 1
+        while count * 2 <= min(length, MAX_EXTENT_BLOCKS):
+            count *= 2
+        extents.append((begin, end, count))
+
+    # Keep the longest runs, where larger reads save the most requests
+    extents.sort(key=lambda e: e[0] - e[1])
+    return sorted(extents[:MAX_EXTENTS])
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description="Build ROM cache pin sets from ROM access traces.")
+    parser.add_argument("traces", nargs="+", help="debug output containing ROMTRACE lines")
+    parser.add_argument("-o", "--output", default=".", help="directory for the <code>.PIN files")
+    parser.add_argument(
+        "--budget",
+        type=lambda x: int(x, 0),
+        default=0x800000,
+        help="maximum number of bytes to pin (default: 0x800000, the largest ROM RAM cache)",
+    )
+    args = parser.parse_args()
+
+    games = read_traces(args.traces)
+    for code, blocks in sorted(games.items()):
+        ranked = rank_blocks(blocks, args.budget // BLOCK_SIZE)
+        ranges = make_ranges(ranked, args.budget // BLOCK_SIZE)
+        extents = make_extents(blocks, ranges)
+        size = range_blocks(ranges) * BLOCK_SIZE
+
+        path = os.path.join(args.output, f"{code}.PIN")
+        with open(path, "w", newline="\n") as file:
+            file.write(f"# {code} pin set, {size:#x} bytes from {len(args.traces)} trace(s)\n")
+            for begin, end, _ in ranges:
+                file.write(f"0x{begin * BLOCK_SIZE:08X} 0x{(end + 1) * BLOCK_SIZE - 1:08X}\n")
+            for begin, end, count in extents:
+                file.write(
+                    f"X 0x{begin * BLOCK_SIZE:08X} 0x{(end + 1) * BLOCK_SIZE - 1:08X} 0x{count * BLOCK_SIZE:X}\n"
+                )
+        print(f"{path}: {len(ranges)} ranges, {size:#x} bytes, {len(extents)} extents")
+
+
+if __name__ == "__main__":
+    main()